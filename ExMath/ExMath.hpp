@@ -3,6 +3,10 @@
 #define EXMATH_HPP
 
 #include <inc/ExMath_traits.hpp>
+#include <inc/ExMath_dispatch.hpp>
+#include <inc/ExMath_factorization.hpp>
+#include <inc/ExMath_batch.hpp>
+#include <inc/ExMath_dynamic.hpp>
 
 
 #endif
@@ -0,0 +1,341 @@
+#pragma once
+#ifndef EXMATH_BATCH_HPP
+#define EXMATH_BATCH_HPP
+
+#include <inc/ExMath_dispatch.hpp>
+#include <inc/ExMath_factorization.hpp>
+#include <inc/ExMath_traits.hpp>
+
+namespace ExMath
+{
+  // batch independent matrices of equal size stored element-major, batch-minor: all lanes of element (row, col) are contiguous,
+  // so every kernel below runs its innermost loop over the lanes and vectorizes across the batch.
+  // outside of constant evaluation float and double batches use the runtime kernels of the EXMATH library, see isa_t
+  template <index_t rows, index_t columns, typename T, index_t batch> class static_matrix_batch_t
+  {
+  public:
+    using value_type                            = std::remove_cvref_t<T>;
+    static constexpr index_t number_of_rows     = rows;
+    static constexpr index_t number_of_columns  = columns;
+    static constexpr index_t number_of_elements = rows * columns;
+    static constexpr index_t batch_size         = batch;
+
+    using matrix_type = static_matrix_t<rows, columns, value_type>;
+
+    constexpr static_matrix_batch_t() noexcept = default;
+
+    template <storage_order_t order> constexpr explicit static_matrix_batch_t(static_matrix_t<rows, columns, value_type, order> const (&mats)[batch]) noexcept
+    {
+      this->gather(mats);
+    }
+
+    constexpr auto operator()(index_t const& row, index_t const& col, index_t const& lane) const noexcept -> value_type const&
+    {
+      return this->lanes(row, col)[lane];
+    }
+
+    constexpr auto operator()(index_t const& row, index_t const& col, index_t const& lane) noexcept -> value_type& { return this->lanes(row, col)[lane]; }
+
+    // the batch_size values of element (row, col)
+    constexpr auto lanes(index_t const& row, index_t const& col) const noexcept -> value_type const*
+    {
+      return this->m_data + Internal::calc_index_row_major<rows, columns>(row, col) * batch;
+    }
+
+    constexpr auto lanes(index_t const& row, index_t const& col) noexcept -> value_type*
+    {
+      return this->m_data + Internal::calc_index_row_major<rows, columns>(row, col) * batch;
+    }
+
+    template <readable_static_matrix_concept Mat>
+    requires is_same_size<static_matrix_batch_t, Mat> constexpr void set(index_t const& lane, Mat const& mat) noexcept
+    {
+      for (index_t row = 0; row < rows; row++)
+        for (index_t col = 0; col < columns; col++)
+          (*this)(row, col, lane) = mat(row, col);
+    }
+
+    constexpr auto get(index_t const& lane) const noexcept -> matrix_type
+    {
+      matrix_type erg;
+      for (index_t row = 0; row < rows; row++)
+        for (index_t col = 0; col < columns; col++)
+          erg(row, col) = (*this)(row, col, lane);
+      return erg;
+    }
+
+    template <storage_order_t order> constexpr void gather(static_matrix_t<rows, columns, value_type, order> const (&mats)[batch]) noexcept
+    {
+      for (index_t lane = 0; lane < batch; lane++)
+        this->set(lane, mats[lane]);
+    }
+
+    template <storage_order_t order> constexpr void scatter(static_matrix_t<rows, columns, value_type, order> (&mats)[batch]) const noexcept
+    {
+      for (index_t lane = 0; lane < batch; lane++)
+        for (index_t row = 0; row < rows; row++)
+          for (index_t col = 0; col < columns; col++)
+            mats[lane](row, col) = (*this)(row, col, lane);
+    }
+
+    constexpr auto data() const noexcept -> value_type const* { return this->m_data; }
+    constexpr auto data() noexcept -> value_type* { return this->m_data; }
+
+  private:
+    value_type m_data[number_of_elements * batch]{};
+  };
+
+  // one lane of a batch seen as a matrix; lets the single matrix kernels run inside a loop over the lanes
+  template <typename Batch> class batch_lane_view_t
+  {
+  public:
+    using value_type                            = typename std::remove_const_t<Batch>::value_type;
+    static constexpr index_t number_of_rows     = Batch::number_of_rows;
+    static constexpr index_t number_of_columns  = Batch::number_of_columns;
+    static constexpr index_t number_of_elements = Batch::number_of_elements;
+
+    constexpr batch_lane_view_t(Batch& batch, index_t const& lane) noexcept
+        : m_batch{ batch }
+        , m_lane{ lane }
+    {
+    }
+
+    constexpr decltype(auto) operator()(index_t const& row, index_t const& col) const noexcept { return this->m_batch(row, col, this->m_lane); }
+
+  private:
+    Batch&        m_batch;
+    index_t const m_lane;
+  };
+
+  namespace Internal
+  {
+    template <typename Op, typename Erg, typename Lhs, typename Rhs> constexpr void batch_elementwise(Erg& erg, Lhs const& lhs, Rhs const& rhs)
+    {
+      using value_type = typename Erg::value_type;
+
+      auto*           dst   = erg.data();
+      auto const*     a     = lhs.data();
+      auto const*     b     = rhs.data();
+      constexpr index_t count = Erg::number_of_elements * Erg::batch_size;
+
+      if constexpr (runtime_value_type<value_type> && (std::is_same_v<Op, add_op_t> || std::is_same_v<Op, sub_op_t>))
+      {
+        if (!std::is_constant_evaluated())
+        {
+          if constexpr (std::is_same_v<Op, add_op_t>)
+            runtime_add(dst, a, b, count);
+          else
+            runtime_sub(dst, a, b, count);
+          return;
+        }
+      }
+
+      for (index_t idx = 0; idx < count; idx++)
+        dst[idx] = Op::apply(a[idx], b[idx]);
+    }
+
+    template <typename Erg, typename Lhs, typename Rhs> constexpr void batch_mult(Erg& erg, Lhs const& lhs, Rhs const& rhs)
+    {
+      constexpr index_t batch = Erg::batch_size;
+
+      if constexpr (runtime_value_type<typename Erg::value_type>)
+      {
+        if (!std::is_constant_evaluated())
+        {
+          runtime_batch_mult(Erg::number_of_rows, Lhs::number_of_columns, Erg::number_of_columns, batch, lhs.data(), rhs.data(), erg.data());
+          return;
+        }
+      }
+
+      for (index_t row = 0; row < Erg::number_of_rows; row++)
+        for (index_t k = 0; k < Lhs::number_of_columns; k++)
+        {
+          auto const* a = lhs.lanes(row, k);
+          for (index_t col = 0; col < Erg::number_of_columns; col++)
+          {
+            auto*       dst = erg.lanes(row, col);
+            auto const* b   = rhs.lanes(k, col);
+            if (k == 0)
+              for (index_t lane = 0; lane < batch; lane++)
+                dst[lane] = a[lane] * b[lane];
+            else
+              for (index_t lane = 0; lane < batch; lane++)
+                dst[lane] += a[lane] * b[lane];
+          }
+        }
+    }
+
+    // gauss-jordan on every lane at once; the pivot search swaps rows per lane through selects instead of branches,
+    // so all lanes run the same instruction stream. singular lanes yield non-finite values without affecting the others.
+    // the swap mask is held in value_type so that compare and select use the same vector width
+    template <typename Mat, typename Erg> constexpr void batch_solve(Mat& val, Erg& erg)
+    {
+      using value_type          = typename Mat::value_type;
+      constexpr index_t N       = Mat::number_of_rows;
+      constexpr index_t columns = Erg::number_of_columns;
+      constexpr index_t batch   = Mat::batch_size;
+
+      if constexpr (runtime_value_type<value_type>)
+      {
+        if (!std::is_constant_evaluated())
+        {
+          runtime_batch_solve(N, columns, batch, val.data(), erg.data());
+          return;
+        }
+      }
+
+      auto select_swap = [](value_type* lhs, value_type* rhs, value_type const* mask)
+      {
+        for (index_t lane = 0; lane < batch; lane++)
+        {
+          value_type const l   = lhs[lane];
+          value_type const r   = rhs[lane];
+          bool const       sel = mask[lane] != value_type{ 0 };
+          lhs[lane]            = sel ? r : l;
+          rhs[lane]            = sel ? l : r;
+        }
+      };
+
+      auto sub_scaled = [](value_type* dst, value_type const* src, value_type const* fac)
+      {
+        for (index_t lane = 0; lane < batch; lane++)
+          dst[lane] -= fac[lane] * src[lane];
+      };
+
+      value_type mask[batch];
+      value_type fac[batch];
+
+      for (index_t row = 0; row < N; row++)
+      {
+        for (index_t idx = row + 1; idx < N; idx++)
+        {
+          value_type const* cand  = val.lanes(idx, row);
+          value_type const* pivot = val.lanes(row, row);
+          for (index_t lane = 0; lane < batch; lane++)
+            mask[lane] = Internal::abs(pivot[lane]) < Internal::abs(cand[lane]) ? value_type{ 1 } : value_type{ 0 };
+
+          for (index_t col = row; col < N; col++)
+            select_swap(val.lanes(row, col), val.lanes(idx, col), mask);
+          for (index_t col = 0; col < columns; col++)
+            select_swap(erg.lanes(row, col), erg.lanes(idx, col), mask);
+        }
+
+        {
+          value_type const* pivot = val.lanes(row, row);
+          for (index_t lane = 0; lane < batch; lane++)
+            fac[lane] = value_type{ 1 } / pivot[lane];
+
+          for (index_t col = row; col < N; col++)
+          {
+            value_type* dst = val.lanes(row, col);
+            for (index_t lane = 0; lane < batch; lane++)
+              dst[lane] *= fac[lane];
+          }
+          for (index_t col = 0; col < columns; col++)
+          {
+            value_type* dst = erg.lanes(row, col);
+            for (index_t lane = 0; lane < batch; lane++)
+              dst[lane] *= fac[lane];
+          }
+        }
+
+        for (index_t idx = 0; idx < N; idx++)
+        {
+          if (idx == row)
+            continue;
+
+          value_type const* src = val.lanes(idx, row);
+          for (index_t lane = 0; lane < batch; lane++)
+            fac[lane] = src[lane];
+
+          for (index_t col = row; col < N; col++)
+            sub_scaled(val.lanes(idx, col), val.lanes(row, col), fac);
+          for (index_t col = 0; col < columns; col++)
+            sub_scaled(erg.lanes(idx, col), erg.lanes(row, col), fac);
+        }
+      }
+    }
+  }    // namespace Internal
+
+  template <index_t rows, index_t columns, typename T, index_t batch>
+  constexpr auto operator+(static_matrix_batch_t<rows, columns, T, batch> const& lhs, static_matrix_batch_t<rows, columns, T, batch> const& rhs) noexcept
+  {
+    static_matrix_batch_t<rows, columns, T, batch> erg;
+    Internal::batch_elementwise<Internal::add_op_t>(erg, lhs, rhs);
+    return erg;
+  }
+
+  template <index_t rows, index_t columns, typename T, index_t batch>
+  constexpr auto operator-(static_matrix_batch_t<rows, columns, T, batch> const& lhs, static_matrix_batch_t<rows, columns, T, batch> const& rhs) noexcept
+  {
+    static_matrix_batch_t<rows, columns, T, batch> erg;
+    Internal::batch_elementwise<Internal::sub_op_t>(erg, lhs, rhs);
+    return erg;
+  }
+
+  template <index_t rows, index_t inner, index_t columns, typename T, index_t batch>
+  constexpr auto operator*(static_matrix_batch_t<rows, inner, T, batch> const& lhs, static_matrix_batch_t<inner, columns, T, batch> const& rhs) noexcept
+  {
+    static_matrix_batch_t<rows, columns, T, batch> erg;
+    Internal::batch_mult(erg, lhs, rhs);
+    return erg;
+  }
+
+  template <index_t rows, index_t columns, typename T, index_t batch>
+  constexpr auto operator*(static_matrix_batch_t<rows, columns, T, batch> const&                          lhs,
+                           typename static_matrix_batch_t<rows, columns, T, batch>::value_type const& rhs) noexcept
+  {
+    static_matrix_batch_t<rows, columns, T, batch> erg;
+    auto*                                          dst = erg.data();
+    auto const*                                    src = lhs.data();
+    for (index_t idx = 0; idx < rows * columns * batch; idx++)
+      dst[idx] = src[idx] * rhs;
+    return erg;
+  }
+
+  template <index_t rows, index_t columns, typename T, index_t batch>
+  constexpr auto operator*(typename static_matrix_batch_t<rows, columns, T, batch>::value_type const& lhs,
+                           static_matrix_batch_t<rows, columns, T, batch> const&                          rhs) noexcept
+  {
+    return rhs * lhs;
+  }
+
+  // solves mat * x = b for every lane
+  template <index_t N, index_t columns, typename T, index_t batch>
+  constexpr auto solve(static_matrix_batch_t<N, N, T, batch> const& mat, static_matrix_batch_t<N, columns, T, batch> const& b) noexcept
+  {
+    static_matrix_batch_t<N, N, T, batch>       val = mat;
+    static_matrix_batch_t<N, columns, T, batch> erg = b;
+    Internal::batch_solve(val, erg);
+    return erg;
+  }
+
+  template <index_t N, typename T, index_t batch> constexpr auto inverse(static_matrix_batch_t<N, N, T, batch> const& mat) noexcept
+  {
+    using value_type = typename static_matrix_batch_t<N, N, T, batch>::value_type;
+
+    static_matrix_batch_t<N, N, T, batch> erg;
+    if constexpr (N <= Internal::closed_form_max_size)
+    {
+      for (index_t lane = 0; lane < batch; lane++)
+      {
+        batch_lane_view_t dst{ erg, lane };
+        value_type const  fac = value_type{ 1 } / Internal::adjugate(dst, batch_lane_view_t{ mat, lane });
+        for (index_t row = 0; row < N; row++)
+          for (index_t col = 0; col < N; col++)
+            dst(row, col) *= fac;
+      }
+      return erg;
+    }
+
+    for (index_t idx = 0; idx < N; idx++)
+    {
+      value_type* dst = erg.lanes(idx, idx);
+      for (index_t lane = 0; lane < batch; lane++)
+        dst[lane] = value_type{ 1 };
+    }
+    return solve(mat, erg);
+  }
+}    // namespace ExMath
+
+#endif
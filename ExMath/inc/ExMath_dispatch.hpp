@@ -0,0 +1,74 @@
+#pragma once
+#ifndef EXMATH_DISPATCH_HPP
+#define EXMATH_DISPATCH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace ExMath
+{
+  using index_t = uint32_t;
+
+  // instruction set variants the runtime kernels of the EXMATH library are built in
+  enum class isa_t
+  {
+    baseline,    // whatever the library is compiled for, sse2 on plain x86-64
+    avx2,        // avx2 + fma
+    avx512,      // avx512f + avx2 + fma
+  };
+
+  // best variant the running cpu supports; this one is selected at startup
+  auto detected_isa() noexcept -> isa_t;
+  auto selected_isa() noexcept -> isa_t;
+
+  // switches all runtime kernels to isa, e.g. to compare variants in a benchmark; returns false and keeps the current
+  // selection if the cpu or the build does not support isa
+  bool select_isa(isa_t isa) noexcept;
+
+  auto isa_name(isa_t isa) noexcept -> char const*;
+
+  namespace Internal
+  {
+    // element (row, col) of a runtime kernel operand lives at data[row * row_stride + col * column_stride]
+    template <typename T> struct strided_ref_t
+    {
+      T*      data;
+      index_t row_stride;
+      index_t column_stride;
+    };
+
+    template <typename T> concept runtime_value_type = std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+    // non-template kernels compiled once per isa_t in ExMath.cpp and called through the selected variant
+    void runtime_add(float* erg, float const* lhs, float const* rhs, std::size_t count) noexcept;
+    void runtime_add(double* erg, double const* lhs, double const* rhs, std::size_t count) noexcept;
+    void runtime_sub(float* erg, float const* lhs, float const* rhs, std::size_t count) noexcept;
+    void runtime_sub(double* erg, double const* lhs, double const* rhs, std::size_t count) noexcept;
+
+    // erg = alpha * lhs * rhs + beta * erg for a rows x depth lhs and a depth x columns rhs; erg is not read if beta is zero
+    void runtime_gemm(index_t rows, index_t columns, index_t depth, float alpha, strided_ref_t<float const> lhs, strided_ref_t<float const> rhs, float beta,
+                      strided_ref_t<float> erg) noexcept;
+    void runtime_gemm(index_t rows, index_t columns, index_t depth, double alpha, strided_ref_t<double const> lhs, strided_ref_t<double const> rhs,
+                      double beta, strided_ref_t<double> erg) noexcept;
+
+    // overwrites the n x n mat with its lu factors and the n x columns b with the solution of mat * x = b; rows must be unit stride
+    void runtime_lu_solve(index_t n, index_t columns, strided_ref_t<float> mat, strided_ref_t<float> b) noexcept;
+    void runtime_lu_solve(index_t n, index_t columns, strided_ref_t<double> mat, strided_ref_t<double> b) noexcept;
+
+    // the kernels of lu_factorization_t, which leaves the rows in place: factors the n x n mat into the rows perm names and returns
+    // true if a zero pivot was met, and substitutes through such factors into the n x columns erg that holds b in the order of perm
+    bool runtime_lu_factor(index_t n, strided_ref_t<float> mat, index_t* perm, bool& odd_permutation) noexcept;
+    bool runtime_lu_factor(index_t n, strided_ref_t<double> mat, index_t* perm, bool& odd_permutation) noexcept;
+    void runtime_lu_substitute(index_t n, index_t columns, strided_ref_t<float const> lu, index_t const* perm, strided_ref_t<float> erg) noexcept;
+    void runtime_lu_substitute(index_t n, index_t columns, strided_ref_t<double const> lu, index_t const* perm, strided_ref_t<double> erg) noexcept;
+
+    // the batch kernels of static_matrix_batch_t on element-major, batch-minor buffers
+    void runtime_batch_mult(index_t rows, index_t inner, index_t columns, index_t batch, float const* lhs, float const* rhs, float* erg) noexcept;
+    void runtime_batch_mult(index_t rows, index_t inner, index_t columns, index_t batch, double const* lhs, double const* rhs, double* erg) noexcept;
+    void runtime_batch_solve(index_t n, index_t columns, index_t batch, float* mat, float* erg) noexcept;
+    void runtime_batch_solve(index_t n, index_t columns, index_t batch, double* mat, double* erg) noexcept;
+  }    // namespace Internal
+}    // namespace ExMath
+
+#endif
@@ -0,0 +1,330 @@
+#pragma once
+#ifndef EXMATH_DYNAMIC_HPP
+#define EXMATH_DYNAMIC_HPP
+
+#include <inc/ExMath_dispatch.hpp>
+#include <inc/ExMath_traits.hpp>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+namespace ExMath
+{
+  // row major matrix with dimensions chosen at runtime; every result allocates from the allocator of its left operand,
+  // so a std::pmr arena passed in once serves all temporaries of an expression.
+  // float and double matrices run on the runtime kernels of the EXMATH library, see isa_t.
+  // operations on mismatching dimensions return an empty (0 x 0) matrix instead of touching memory out of range;
+  // += and -= on mismatching dimensions leave their left operand unchanged
+  template <typename T, typename Allocator = std::pmr::polymorphic_allocator<std::remove_cvref_t<T>>> class dynamic_matrix_t
+  {
+  public:
+    using value_type                               = std::remove_cvref_t<T>;
+    using allocator_type                           = Allocator;
+    static constexpr storage_order_t storage_order = storage_order_t::row_major;
+
+    dynamic_matrix_t() = default;
+
+    explicit dynamic_matrix_t(allocator_type const& alloc)
+        : m_data(alloc)
+    {
+    }
+
+    dynamic_matrix_t(index_t const& rows, index_t const& columns, allocator_type const& alloc = allocator_type())
+        : m_rows{ rows }
+        , m_columns{ columns }
+        , m_data(static_cast<std::size_t>(rows) * columns, value_type{}, alloc)
+    {
+    }
+
+    template <typename Fnc>
+    requires std::is_invocable_r_v<value_type, Fnc, index_t const&, index_t const&>
+    dynamic_matrix_t(index_t const& rows, index_t const& columns, Fnc&& fnc, allocator_type const& alloc = allocator_type())
+        : dynamic_matrix_t(rows, columns, alloc)
+    {
+      for (index_t row = 0; row < rows; row++)
+        for (index_t col = 0; col < columns; col++)
+          (*this)(row, col) = fnc(row, col);
+    }
+
+    template <readable_static_matrix_concept Rhs>
+    explicit dynamic_matrix_t(Rhs const& rhs, allocator_type const& alloc = allocator_type())
+        : dynamic_matrix_t(Rhs::number_of_rows, Rhs::number_of_columns, rhs, alloc)
+    {
+    }
+
+    dynamic_matrix_t(dynamic_matrix_t const& rhs, allocator_type const& alloc)
+        : m_rows{ rhs.m_rows }
+        , m_columns{ rhs.m_columns }
+        , m_data(rhs.m_data, alloc)
+    {
+    }
+
+    dynamic_matrix_t(dynamic_matrix_t const&)     = default;
+    dynamic_matrix_t(dynamic_matrix_t&&) noexcept = default;
+    auto operator=(dynamic_matrix_t const&) -> dynamic_matrix_t& = default;
+    auto operator=(dynamic_matrix_t&&) -> dynamic_matrix_t& = default;
+
+    auto rows() const noexcept -> index_t { return this->m_rows; }
+    auto columns() const noexcept -> index_t { return this->m_columns; }
+    bool empty() const noexcept { return this->m_data.empty(); }
+
+    auto operator()(index_t const& row, index_t const& col) const noexcept -> value_type const&
+    {
+      return this->m_data[static_cast<std::size_t>(row) * this->m_columns + col];
+    }
+
+    auto operator()(index_t const& row, index_t const& col) noexcept -> value_type&
+    {
+      return this->m_data[static_cast<std::size_t>(row) * this->m_columns + col];
+    }
+
+    auto data() const noexcept -> value_type const* { return this->m_data.data(); }
+    auto data() noexcept -> value_type* { return this->m_data.data(); }
+
+    auto get_allocator() const noexcept -> allocator_type { return this->m_data.get_allocator(); }
+
+  private:
+    index_t                                 m_rows    = 0;
+    index_t                                 m_columns = 0;
+    std::vector<value_type, allocator_type> m_data;
+  };
+
+  namespace Internal
+  {
+    template <typename T, typename A> bool is_same_size_dynamic(dynamic_matrix_t<T, A> const& lhs, dynamic_matrix_t<T, A> const& rhs) noexcept
+    {
+      return lhs.rows() == rhs.rows() && lhs.columns() == rhs.columns();
+    }
+
+    template <typename Op, typename T, typename A> void dynamic_elementwise(dynamic_matrix_t<T, A>& erg, dynamic_matrix_t<T, A> const& rhs) noexcept
+    {
+      auto*             dst   = erg.data();
+      auto const*       src   = rhs.data();
+      std::size_t const count = static_cast<std::size_t>(erg.rows()) * erg.columns();
+
+      if constexpr (runtime_value_type<typename dynamic_matrix_t<T, A>::value_type> && std::is_same_v<Op, add_op_t>)
+        runtime_add(dst, dst, src, count);
+      else if constexpr (runtime_value_type<typename dynamic_matrix_t<T, A>::value_type> && std::is_same_v<Op, sub_op_t>)
+        runtime_sub(dst, dst, src, count);
+      else
+        for (std::size_t idx = 0; idx < count; idx++)
+          dst[idx] = Op::apply(dst[idx], src[idx]);
+    }
+
+    template <typename Op, typename T, typename A>
+    void dynamic_scale(dynamic_matrix_t<T, A>& erg, typename dynamic_matrix_t<T, A>::value_type const& val) noexcept
+    {
+      auto*             dst   = erg.data();
+      std::size_t const count = static_cast<std::size_t>(erg.rows()) * erg.columns();
+      for (std::size_t idx = 0; idx < count; idx++)
+        dst[idx] = Op::apply(dst[idx], val);
+    }
+
+    // erg = lhs * rhs in row/inner/column order: the innermost loop streams one row of rhs into one row of erg with unit stride
+    template <typename T, typename A>
+    void dynamic_mult(dynamic_matrix_t<T, A>& erg, dynamic_matrix_t<T, A> const& lhs, dynamic_matrix_t<T, A> const& rhs) noexcept
+    {
+      using value_type = typename dynamic_matrix_t<T, A>::value_type;
+
+      if constexpr (runtime_value_type<value_type>)
+      {
+        runtime_gemm(lhs.rows(),
+                     rhs.columns(),
+                     lhs.columns(),
+                     value_type{ 1 },
+                     { lhs.data(), lhs.columns(), 1 },
+                     { rhs.data(), rhs.columns(), 1 },
+                     value_type{ 0 },
+                     { erg.data(), erg.columns(), 1 });
+        return;
+      }
+
+      index_t const columns = rhs.columns();
+      for (index_t row = 0; row < lhs.rows(); row++)
+      {
+        value_type* dst = &erg(row, 0);
+        for (index_t col = 0; col < columns; col++)
+          dst[col] = value_type{ 0 };
+
+        for (index_t k = 0; k < lhs.columns(); k++)
+        {
+          value_type const  fac = lhs(row, k);
+          value_type const* src = &rhs(k, 0);
+          for (index_t col = 0; col < columns; col++)
+            dst[col] += fac * src[col];
+        }
+      }
+    }
+
+    // overwrites val with its lu factors and b with the solution of val * x = b; rows are exchanged physically for partial pivoting
+    template <typename T, typename A> void dynamic_solve(dynamic_matrix_t<T, A>& val, dynamic_matrix_t<T, A>& b) noexcept
+    {
+      using value_type = typename dynamic_matrix_t<T, A>::value_type;
+
+      index_t const N       = val.rows();
+      index_t const columns = b.columns();
+
+      if constexpr (runtime_value_type<value_type>)
+      {
+        runtime_lu_solve(N, columns, { val.data(), val.columns(), 1 }, { b.data(), b.columns(), 1 });
+        return;
+      }
+
+      auto swap_rows = [](dynamic_matrix_t<T, A>& mat, index_t const& r1, index_t const& r2)
+      {
+        value_type* lhs = &mat(r1, 0);
+        value_type* rhs = &mat(r2, 0);
+        for (index_t col = 0; col < mat.columns(); col++)
+          std::swap(lhs[col], rhs[col]);
+      };
+
+      for (index_t col = 0; col < N; col++)
+      {
+        index_t sel_idx = col;
+        for (index_t idx = col + 1; idx < N; idx++)
+          if (Internal::abs(val(sel_idx, col)) < Internal::abs(val(idx, col)))
+            sel_idx = idx;
+
+        if (sel_idx != col)
+        {
+          swap_rows(val, sel_idx, col);
+          swap_rows(b, sel_idx, col);
+        }
+
+        value_type const  pivot = val(col, col);
+        value_type const* src   = &val(col, 0);
+        value_type const* src_b = &b(col, 0);
+        for (index_t idx = col + 1; idx < N; idx++)
+        {
+          value_type*      dst   = &val(idx, 0);
+          value_type*      dst_b = &b(idx, 0);
+          value_type const fac   = dst[col] / pivot;
+
+          dst[col] = fac;
+          for (index_t c = col + 1; c < N; c++)
+            dst[c] -= fac * src[c];
+          for (index_t c = 0; c < columns; c++)
+            dst_b[c] -= fac * src_b[c];
+        }
+      }
+
+      for (index_t row = N; row-- > 0;)
+      {
+        value_type* dst = &b(row, 0);
+        for (index_t idx = row + 1; idx < N; idx++)
+        {
+          value_type const  fac = val(row, idx);
+          value_type const* src = &b(idx, 0);
+          for (index_t col = 0; col < columns; col++)
+            dst[col] -= fac * src[col];
+        }
+
+        value_type const fac = val(row, row);
+        for (index_t col = 0; col < columns; col++)
+          dst[col] /= fac;
+      }
+    }
+  }    // namespace Internal
+
+  template <typename T, typename A> auto operator+=(dynamic_matrix_t<T, A>& erg, dynamic_matrix_t<T, A> const& rhs) noexcept -> dynamic_matrix_t<T, A>&
+  {
+    if (Internal::is_same_size_dynamic(erg, rhs))
+      Internal::dynamic_elementwise<Internal::add_op_t>(erg, rhs);
+    return erg;
+  }
+
+  template <typename T, typename A> auto operator-=(dynamic_matrix_t<T, A>& erg, dynamic_matrix_t<T, A> const& rhs) noexcept -> dynamic_matrix_t<T, A>&
+  {
+    if (Internal::is_same_size_dynamic(erg, rhs))
+      Internal::dynamic_elementwise<Internal::sub_op_t>(erg, rhs);
+    return erg;
+  }
+
+  template <typename T, typename A>
+  auto operator*=(dynamic_matrix_t<T, A>& erg, typename dynamic_matrix_t<T, A>::value_type const& val) noexcept -> dynamic_matrix_t<T, A>&
+  {
+    Internal::dynamic_scale<Internal::mul_op_t>(erg, val);
+    return erg;
+  }
+
+  template <typename T, typename A>
+  auto operator/=(dynamic_matrix_t<T, A>& erg, typename dynamic_matrix_t<T, A>::value_type const& val) noexcept -> dynamic_matrix_t<T, A>&
+  {
+    Internal::dynamic_scale<Internal::div_op_t>(erg, val);
+    return erg;
+  }
+
+  template <typename T, typename A> auto operator+(dynamic_matrix_t<T, A> const& lhs, dynamic_matrix_t<T, A> const& rhs)
+  {
+    if (!Internal::is_same_size_dynamic(lhs, rhs))
+      return dynamic_matrix_t<T, A>(lhs.get_allocator());
+
+    dynamic_matrix_t<T, A> erg{ lhs, lhs.get_allocator() };
+    erg += rhs;
+    return erg;
+  }
+
+  template <typename T, typename A> auto operator-(dynamic_matrix_t<T, A> const& lhs, dynamic_matrix_t<T, A> const& rhs)
+  {
+    if (!Internal::is_same_size_dynamic(lhs, rhs))
+      return dynamic_matrix_t<T, A>(lhs.get_allocator());
+
+    dynamic_matrix_t<T, A> erg{ lhs, lhs.get_allocator() };
+    erg -= rhs;
+    return erg;
+  }
+
+  template <typename T, typename A> auto operator*(dynamic_matrix_t<T, A> const& lhs, typename dynamic_matrix_t<T, A>::value_type const& rhs)
+  {
+    dynamic_matrix_t<T, A> erg{ lhs, lhs.get_allocator() };
+    erg *= rhs;
+    return erg;
+  }
+
+  template <typename T, typename A> auto operator*(typename dynamic_matrix_t<T, A>::value_type const& lhs, dynamic_matrix_t<T, A> const& rhs)
+  {
+    return rhs * lhs;
+  }
+
+  template <typename T, typename A> auto operator*(dynamic_matrix_t<T, A> const& lhs, dynamic_matrix_t<T, A> const& rhs)
+  {
+    if (lhs.columns() != rhs.rows())
+      return dynamic_matrix_t<T, A>(lhs.get_allocator());
+
+    dynamic_matrix_t<T, A> erg(lhs.rows(), rhs.columns(), lhs.get_allocator());
+    Internal::dynamic_mult(erg, lhs, rhs);
+    return erg;
+  }
+
+  template <typename T, typename A> auto transpose(dynamic_matrix_t<T, A> const& val)
+  {
+    dynamic_matrix_t<T, A> erg(val.columns(), val.rows(), val.get_allocator());
+    for (index_t row = 0; row < val.rows(); row++)
+      for (index_t col = 0; col < val.columns(); col++)
+        erg(col, row) = val(row, col);
+    return erg;
+  }
+
+  // solves mat * x = b; singular systems yield non-finite values
+  template <typename T, typename A> auto solve(dynamic_matrix_t<T, A> const& mat, dynamic_matrix_t<T, A> const& b)
+  {
+    if (mat.rows() != mat.columns() || mat.rows() != b.rows())
+      return dynamic_matrix_t<T, A>(mat.get_allocator());
+
+    dynamic_matrix_t<T, A> val{ mat, mat.get_allocator() };
+    dynamic_matrix_t<T, A> erg{ b, mat.get_allocator() };
+    Internal::dynamic_solve(val, erg);
+    return erg;
+  }
+
+  template <typename T, typename A> auto inverse(dynamic_matrix_t<T, A> const& mat)
+  {
+    using value_type = typename dynamic_matrix_t<T, A>::value_type;
+
+    dynamic_matrix_t<T, A> id(
+        mat.rows(), mat.rows(), [](index_t const& row, index_t const& col) { return row == col ? value_type{ 1 } : value_type{ 0 }; }, mat.get_allocator());
+    return solve(mat, id);
+  }
+}    // namespace ExMath
+
+#endif
@@ -0,0 +1,857 @@
+#pragma once
+#ifndef EXMATH_FACTORIZATION_HPP
+#define EXMATH_FACTORIZATION_HPP
+
+#include <inc/ExMath_traits.hpp>
+#include <utility>
+
+namespace ExMath
+{
+  namespace Internal
+  {
+    // solves lhs * x = erg in place of erg reading only the lower triangle of lhs; a unit_diagonal is taken as ones and not read
+    template <bool unit_diagonal = false, typename Lhs, writeable_static_matrix_concept Erg>
+    requires(Lhs::number_of_rows == Lhs::number_of_columns && Lhs::number_of_rows == Erg::number_of_rows) constexpr void forward_substitution(
+        Lhs const& lhs, Erg& erg) noexcept
+    {
+      using value_type = typename Erg::value_type;
+
+      for (index_t row = 0; row < Erg::number_of_rows; row++)
+      {
+        for (index_t idx = 0; idx < row; idx++)
+        {
+          value_type const fac = stored(lhs, row, idx);
+          for (index_t col = 0; col < Erg::number_of_columns; col++)
+            erg(row, col) -= fac * erg(idx, col);
+        }
+
+        if constexpr (!unit_diagonal)
+        {
+          value_type const fac = stored(lhs, row, row);
+          for (index_t col = 0; col < Erg::number_of_columns; col++)
+            erg(row, col) /= fac;
+        }
+      }
+    }
+
+    // solves lhs * x = erg in place of erg reading only the upper triangle of lhs
+    template <bool unit_diagonal = false, typename Lhs, writeable_static_matrix_concept Erg>
+    requires(Lhs::number_of_rows == Lhs::number_of_columns && Lhs::number_of_rows == Erg::number_of_rows) constexpr void back_substitution(
+        Lhs const& lhs, Erg& erg) noexcept
+    {
+      using value_type = typename Erg::value_type;
+
+      for (index_t row = Erg::number_of_rows; row-- > 0;)
+      {
+        for (index_t idx = row + 1; idx < Erg::number_of_rows; idx++)
+        {
+          value_type const fac = stored(lhs, row, idx);
+          for (index_t col = 0; col < Erg::number_of_columns; col++)
+            erg(row, col) -= fac * erg(idx, col);
+        }
+
+        if constexpr (!unit_diagonal)
+        {
+          value_type const fac = stored(lhs, row, row);
+          for (index_t col = 0; col < Erg::number_of_columns; col++)
+            erg(row, col) /= fac;
+        }
+      }
+    }
+
+    // largest size inverse and determinant evaluate via the closed form cofactor expansion instead of a factorization
+    constexpr index_t closed_form_max_size = 4;
+
+    // writes the adjugate of mat to erg and returns det(mat); inverse(mat) = erg / det(mat)
+    template <writeable_static_matrix_concept Erg, readable_static_matrix_concept T>
+    requires(T::number_of_rows == T::number_of_columns && T::number_of_rows <= closed_form_max_size && is_same_size<Erg, T>) constexpr auto
+    adjugate(Erg& erg, T const& mat) noexcept -> typename Erg::value_type
+    {
+      using value_type = typename Erg::value_type;
+
+      if constexpr (T::number_of_rows == 1)
+      {
+        erg(0, 0) = value_type{ 1 };
+        return mat(0, 0);
+      }
+      else if constexpr (T::number_of_rows == 2)
+      {
+        value_type const a = mat(0, 0), b = mat(0, 1);
+        value_type const c = mat(1, 0), d = mat(1, 1);
+
+        erg(0, 0) = d;
+        erg(0, 1) = -b;
+        erg(1, 0) = -c;
+        erg(1, 1) = a;
+        return a * d - b * c;
+      }
+      else if constexpr (T::number_of_rows == 3)
+      {
+        value_type const a = mat(0, 0), b = mat(0, 1), c = mat(0, 2);
+        value_type const d = mat(1, 0), e = mat(1, 1), f = mat(1, 2);
+        value_type const g = mat(2, 0), h = mat(2, 1), i = mat(2, 2);
+
+        value_type const c00 = e * i - f * h;
+        value_type const c01 = f * g - d * i;
+        value_type const c02 = d * h - e * g;
+
+        erg(0, 0) = c00;
+        erg(0, 1) = c * h - b * i;
+        erg(0, 2) = b * f - c * e;
+        erg(1, 0) = c01;
+        erg(1, 1) = a * i - c * g;
+        erg(1, 2) = c * d - a * f;
+        erg(2, 0) = c02;
+        erg(2, 1) = b * g - a * h;
+        erg(2, 2) = a * e - b * d;
+        return a * c00 + b * c01 + c * c02;
+      }
+      else
+      {
+        value_type const a00 = mat(0, 0), a01 = mat(0, 1), a02 = mat(0, 2), a03 = mat(0, 3);
+        value_type const a10 = mat(1, 0), a11 = mat(1, 1), a12 = mat(1, 2), a13 = mat(1, 3);
+        value_type const a20 = mat(2, 0), a21 = mat(2, 1), a22 = mat(2, 2), a23 = mat(2, 3);
+        value_type const a30 = mat(3, 0), a31 = mat(3, 1), a32 = mat(3, 2), a33 = mat(3, 3);
+
+        // 2x2 minors of the upper (s) and lower (c) two rows
+        value_type const s0 = a00 * a11 - a10 * a01;
+        value_type const s1 = a00 * a12 - a10 * a02;
+        value_type const s2 = a00 * a13 - a10 * a03;
+        value_type const s3 = a01 * a12 - a11 * a02;
+        value_type const s4 = a01 * a13 - a11 * a03;
+        value_type const s5 = a02 * a13 - a12 * a03;
+        value_type const c0 = a20 * a31 - a30 * a21;
+        value_type const c1 = a20 * a32 - a30 * a22;
+        value_type const c2 = a20 * a33 - a30 * a23;
+        value_type const c3 = a21 * a32 - a31 * a22;
+        value_type const c4 = a21 * a33 - a31 * a23;
+        value_type const c5 = a22 * a33 - a32 * a23;
+
+        erg(0, 0) = a11 * c5 - a12 * c4 + a13 * c3;
+        erg(0, 1) = -a01 * c5 + a02 * c4 - a03 * c3;
+        erg(0, 2) = a31 * s5 - a32 * s4 + a33 * s3;
+        erg(0, 3) = -a21 * s5 + a22 * s4 - a23 * s3;
+        erg(1, 0) = -a10 * c5 + a12 * c2 - a13 * c1;
+        erg(1, 1) = a00 * c5 - a02 * c2 + a03 * c1;
+        erg(1, 2) = -a30 * s5 + a32 * s2 - a33 * s1;
+        erg(1, 3) = a20 * s5 - a22 * s2 + a23 * s1;
+        erg(2, 0) = a10 * c4 - a11 * c2 + a13 * c0;
+        erg(2, 1) = -a00 * c4 + a01 * c2 - a03 * c0;
+        erg(2, 2) = a30 * s4 - a31 * s2 + a33 * s0;
+        erg(2, 3) = -a20 * s4 + a21 * s2 - a23 * s0;
+        erg(3, 0) = -a10 * c3 + a11 * c1 - a12 * c0;
+        erg(3, 1) = a00 * c3 - a01 * c1 + a02 * c0;
+        erg(3, 2) = -a30 * s3 + a31 * s1 - a32 * s0;
+        erg(3, 3) = a20 * s3 - a21 * s1 + a22 * s0;
+        return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+      }
+    }
+
+    // det(mat) expanded along the first row; only the cofactors of that row are computed
+    template <readable_static_matrix_concept T>
+    requires(T::number_of_rows == T::number_of_columns && T::number_of_rows <= closed_form_max_size) constexpr auto
+    closed_form_determinant(T const& mat) noexcept -> typename T::value_type
+    {
+      using value_type = typename T::value_type;
+
+      if constexpr (T::number_of_rows == 1)
+      {
+        return mat(0, 0);
+      }
+      else if constexpr (T::number_of_rows == 2)
+      {
+        return mat(0, 0) * mat(1, 1) - mat(0, 1) * mat(1, 0);
+      }
+      else if constexpr (T::number_of_rows == 3)
+      {
+        value_type const d = mat(1, 0), e = mat(1, 1), f = mat(1, 2);
+        value_type const g = mat(2, 0), h = mat(2, 1), i = mat(2, 2);
+        return mat(0, 0) * (e * i - f * h) + mat(0, 1) * (f * g - d * i) + mat(0, 2) * (d * h - e * g);
+      }
+      else
+      {
+        value_type const a10 = mat(1, 0), a11 = mat(1, 1), a12 = mat(1, 2), a13 = mat(1, 3);
+        value_type const a20 = mat(2, 0), a21 = mat(2, 1), a22 = mat(2, 2), a23 = mat(2, 3);
+        value_type const a30 = mat(3, 0), a31 = mat(3, 1), a32 = mat(3, 2), a33 = mat(3, 3);
+
+        // 2x2 minors of the lower two rows
+        value_type const c0 = a20 * a31 - a30 * a21;
+        value_type const c1 = a20 * a32 - a30 * a22;
+        value_type const c2 = a20 * a33 - a30 * a23;
+        value_type const c3 = a21 * a32 - a31 * a22;
+        value_type const c4 = a21 * a33 - a31 * a23;
+        value_type const c5 = a22 * a33 - a32 * a23;
+
+        return mat(0, 0) * (a11 * c5 - a12 * c4 + a13 * c3) - mat(0, 1) * (a10 * c5 - a12 * c2 + a13 * c1) +
+               mat(0, 2) * (a10 * c4 - a11 * c2 + a13 * c0) - mat(0, 3) * (a10 * c3 - a11 * c1 + a12 * c0);
+      }
+    }
+
+    // overwrites erg with the solution of mat * x = erg for a tridiagonal mat by the thomas algorithm, gaussian elimination on the
+    // three diagonals without pivoting, and returns true. stable for diagonally dominant or symmetric positive definite mat, as
+    // they come from splines and implicit diffusion steps. returns false if a pivot is zero or tiny against its row, which needs
+    // pivoting; erg then holds no solution
+    template <typename Mat, writeable_static_matrix_concept Erg>
+    requires(Mat::number_of_rows == Erg::number_of_rows) constexpr bool tridiagonal_solve(Mat const& mat, Erg& erg) noexcept
+    {
+      using value_type          = typename Erg::value_type;
+      constexpr index_t n       = Erg::number_of_rows;
+      constexpr index_t columns = Erg::number_of_columns;
+      constexpr auto    eps     = std::numeric_limits<value_type>::epsilon();
+
+      // the super diagonal divided by the pivots, the only part of the elimination the back substitution needs
+      value_type upper[n]{};
+
+      // the check does not branch, a failed pivot only spoils erg
+      value_type sup = n > 1 ? mat.element(0, 1) : value_type{ 0 };
+      bool       ok  = Internal::abs(mat.element(0, 0)) > eps * (Internal::abs(mat.element(0, 0)) + Internal::abs(sup));
+      value_type fac = value_type{ 1 } / mat.element(0, 0);
+      upper[0]       = sup * fac;
+      for (index_t col = 0; col < columns; col++)
+        erg(0, col) *= fac;
+
+      for (index_t row = 1; row < n; row++)
+      {
+        value_type const sub   = mat.element(row, row - 1);
+        value_type const diag  = mat.element(row, row);
+        value_type const pivot = diag - sub * upper[row - 1];
+        sup                    = row + 1 < n ? mat.element(row, row + 1) : value_type{ 0 };
+        ok                     &= Internal::abs(pivot) > eps * (Internal::abs(sub) + Internal::abs(diag) + Internal::abs(sup));
+        fac                    = value_type{ 1 } / pivot;
+        upper[row]             = sup * fac;
+        for (index_t col = 0; col < columns; col++)
+          erg(row, col) = (erg(row, col) - sub * erg(row - 1, col)) * fac;
+      }
+
+      for (index_t row = n - 1; row-- > 0;)
+        for (index_t col = 0; col < columns; col++)
+          erg(row, col) -= upper[row] * erg(row + 1, col);
+      return ok;
+    }
+  }    // namespace Internal
+
+  // P * A = L * U with partial pivoting; rows are never moved, row idx of L and U lives in row m_perm[idx] of m_lu
+  template <index_t N, typename T> class lu_factorization_t
+  {
+  public:
+    using value_type                           = std::remove_cvref_t<T>;
+    static constexpr index_t number_of_rows    = N;
+    static constexpr index_t number_of_columns = N;
+
+    template <readable_static_matrix_concept Mat>
+    requires(Mat::number_of_rows == N && Mat::number_of_columns == N) constexpr lu_factorization_t(Mat const& mat) noexcept
+        : m_lu{ mat }
+    {
+      this->factor();
+    }
+
+    // true if a zero pivot was met; solve and inverse then yield non-finite values
+    constexpr bool is_singular() const noexcept { return this->m_singular; }
+
+    constexpr auto determinant() const noexcept -> value_type
+    {
+      value_type erg = this->m_odd_permutation ? value_type{ -1 } : value_type{ 1 };
+      for (index_t idx = 0; idx < N; idx++)
+        erg *= this->upper(idx, idx);
+      return erg;
+    }
+
+    template <readable_static_matrix_concept Rhs> requires(Rhs::number_of_rows == N) constexpr auto solve(Rhs const& b) const noexcept
+    {
+      constexpr index_t columns = Rhs::number_of_columns;
+
+      static_matrix_t<N, columns, value_type> erg;
+
+      if constexpr (Internal::runtime_kernel_concept<lu_t>)
+      {
+        if (!std::is_constant_evaluated())
+        {
+          for (index_t row = 0; row < N; row++)
+            for (index_t col = 0; col < columns; col++)
+              erg(row, col) = b(this->m_perm[row], col);
+          Internal::runtime_lu_substitute(N, columns, { this->m_lu.data(), Internal::row_stride_of(this->m_lu), 1 }, this->m_perm,
+                                          { erg.data(), Internal::row_stride_of(erg), 1 });
+          return erg;
+        }
+      }
+
+      for (index_t row = 0; row < N; row++)
+      {
+        for (index_t col = 0; col < columns; col++)
+          erg(row, col) = b(this->m_perm[row], col);
+
+        for (index_t idx = 0; idx < row; idx++)
+        {
+          value_type const fac = this->lower(row, idx);
+          for (index_t col = 0; col < columns; col++)
+            erg(row, col) -= fac * erg(idx, col);
+        }
+      }
+
+      for (index_t row = N; row-- > 0;)
+      {
+        for (index_t idx = row + 1; idx < N; idx++)
+        {
+          value_type const fac = this->upper(row, idx);
+          for (index_t col = 0; col < columns; col++)
+            erg(row, col) -= fac * erg(idx, col);
+        }
+
+        value_type const fac = this->upper(row, row);
+        for (index_t col = 0; col < columns; col++)
+          erg(row, col) /= fac;
+      }
+
+      return erg;
+    }
+
+    constexpr auto inverse() const noexcept { return this->solve(identity_matrix_t<N, N, value_type>()); }
+
+  private:
+    constexpr auto lower(index_t const& row, index_t const& col) const noexcept -> value_type const& { return this->m_lu(this->m_perm[row], col); }
+    constexpr auto upper(index_t const& row, index_t const& col) const noexcept -> value_type const& { return this->m_lu(this->m_perm[row], col); }
+
+    // sizes of the runtime kernels are factored by the non-template kernel of the selected isa_t
+    constexpr void factor() noexcept
+    {
+      if constexpr (Internal::runtime_kernel_concept<lu_t>)
+      {
+        if (!std::is_constant_evaluated())
+        {
+          this->m_singular =
+              Internal::runtime_lu_factor(N, { this->m_lu.data(), Internal::row_stride_of(this->m_lu), 1 }, this->m_perm, this->m_odd_permutation);
+          return;
+        }
+      }
+
+      for (index_t idx = 0; idx < N; idx++)
+        this->m_perm[idx] = idx;
+
+      for (index_t col = 0; col < N; col++)
+      {
+        index_t sel_idx = col;
+        for (index_t idx = col + 1; idx < N; idx++)
+          if (Internal::abs(this->m_lu(this->m_perm[sel_idx], col)) < Internal::abs(this->m_lu(this->m_perm[idx], col)))
+            sel_idx = idx;
+
+        if (sel_idx != col)
+        {
+          std::swap(this->m_perm[sel_idx], this->m_perm[col]);
+          this->m_odd_permutation = !this->m_odd_permutation;
+        }
+
+        index_t const    pivot_row = this->m_perm[col];
+        value_type const pivot     = this->m_lu(pivot_row, col);
+        if (pivot == value_type{ 0 })
+        {
+          this->m_singular = true;
+          continue;
+        }
+
+        value_type const* src = &this->m_lu(pivot_row, 0);
+        for (index_t idx = col + 1; idx < N; idx++)
+        {
+          value_type*      dst = &this->m_lu(this->m_perm[idx], 0);
+          value_type const fac = dst[col] / pivot;
+
+          dst[col] = fac;
+          for (index_t c = col + 1; c < N; c++)
+            dst[c] -= fac * src[c];
+        }
+      }
+    }
+
+    using lu_t = static_matrix_t<N, N, value_type>;
+
+    lu_t    m_lu;
+    index_t m_perm[N]{};
+    bool    m_odd_permutation = false;
+    bool    m_singular        = false;
+  };
+
+  template <readable_static_matrix_concept Mat> lu_factorization_t(Mat const&) -> lu_factorization_t<Mat::number_of_rows, typename Mat::value_type>;
+
+  // A = L * L^T for symmetric positive definite A; only the lower triangle of A is read and L overwrites it in place
+  template <index_t N, typename T> class cholesky_t
+  {
+  public:
+    using value_type                           = std::remove_cvref_t<T>;
+    static constexpr index_t number_of_rows    = N;
+    static constexpr index_t number_of_columns = N;
+
+    template <readable_static_matrix_concept Mat>
+    requires(Mat::number_of_rows == N && Mat::number_of_columns == N) constexpr cholesky_t(Mat const& mat) noexcept
+        : m_l{ mat }
+    {
+      this->factor();
+    }
+
+    // false if a non-positive pivot was met; solve then yields non-finite values
+    constexpr bool is_positive_definite() const noexcept { return this->m_positive_definite; }
+
+    constexpr auto log_determinant() const noexcept -> value_type
+    {
+      value_type erg = 0;
+      for (index_t idx = 0; idx < N; idx++)
+        erg += Internal::log(this->m_l(idx, idx));
+      return erg + erg;
+    }
+
+    constexpr auto determinant() const noexcept -> value_type
+    {
+      value_type erg = 1;
+      for (index_t idx = 0; idx < N; idx++)
+        erg *= this->m_l(idx, idx);
+      return erg * erg;
+    }
+
+    template <readable_static_matrix_concept Rhs> requires(Rhs::number_of_rows == N) constexpr auto solve(Rhs const& b) const noexcept
+    {
+      constexpr index_t columns = Rhs::number_of_columns;
+
+      static_matrix_t<N, columns, value_type> erg = b;
+      Internal::forward_substitution(this->m_l, erg);
+      Internal::back_substitution(transpose_view_t<static_matrix_t<N, N, value_type>>{ this->m_l }, erg);
+      return erg;
+    }
+
+    constexpr auto inverse() const noexcept { return this->solve(identity_matrix_t<N, N, value_type>()); }
+
+  private:
+    constexpr void factor() noexcept
+    {
+      for (index_t col = 0; col < N; col++)
+      {
+        value_type diag = this->m_l(col, col);
+        for (index_t idx = 0; idx < col; idx++)
+          diag -= this->m_l(col, idx) * this->m_l(col, idx);
+
+        if (!(diag > value_type{ 0 }))
+          this->m_positive_definite = false;
+
+        diag                = Internal::sqrt(diag);
+        this->m_l(col, col) = diag;
+
+        for (index_t row = col + 1; row < N; row++)
+        {
+          value_type val = this->m_l(row, col);
+          for (index_t idx = 0; idx < col; idx++)
+            val -= this->m_l(row, idx) * this->m_l(col, idx);
+          this->m_l(row, col) = val / diag;
+        }
+      }
+    }
+
+    static_matrix_t<N, N, value_type> m_l;
+    bool                              m_positive_definite = true;
+  };
+
+  // A = L * D * L^T with unit lower L and diagonal D, without square roots; only the lower triangle of A is read
+  template <index_t N, typename T> class ldlt_t
+  {
+  public:
+    using value_type                           = std::remove_cvref_t<T>;
+    static constexpr index_t number_of_rows    = N;
+    static constexpr index_t number_of_columns = N;
+
+    template <readable_static_matrix_concept Mat>
+    requires(Mat::number_of_rows == N && Mat::number_of_columns == N) constexpr ldlt_t(Mat const& mat) noexcept
+        : m_ld{ mat }
+    {
+      this->factor();
+    }
+
+    // true if a zero pivot was met; solve then yields non-finite values
+    constexpr bool is_singular() const noexcept { return this->m_singular; }
+
+    // false if D has a non-positive entry, i.e. A is not positive definite
+    constexpr bool is_positive_definite() const noexcept { return this->m_positive_definite; }
+
+    // log of |det(A)|
+    constexpr auto log_determinant() const noexcept -> value_type
+    {
+      value_type erg = 0;
+      for (index_t idx = 0; idx < N; idx++)
+        erg += Internal::log(Internal::abs(this->m_ld(idx, idx)));
+      return erg;
+    }
+
+    constexpr auto determinant() const noexcept -> value_type
+    {
+      value_type erg = 1;
+      for (index_t idx = 0; idx < N; idx++)
+        erg *= this->m_ld(idx, idx);
+      return erg;
+    }
+
+    template <readable_static_matrix_concept Rhs> requires(Rhs::number_of_rows == N) constexpr auto solve(Rhs const& b) const noexcept
+    {
+      constexpr index_t columns = Rhs::number_of_columns;
+
+      static_matrix_t<N, columns, value_type> erg = b;
+      Internal::forward_substitution<true>(this->m_ld, erg);
+
+      for (index_t row = 0; row < N; row++)
+      {
+        value_type const fac = this->m_ld(row, row);
+        for (index_t col = 0; col < columns; col++)
+          erg(row, col) /= fac;
+      }
+
+      Internal::back_substitution<true>(transpose_view_t<static_matrix_t<N, N, value_type>>{ this->m_ld }, erg);
+      return erg;
+    }
+
+    constexpr auto inverse() const noexcept { return this->solve(identity_matrix_t<N, N, value_type>()); }
+
+  private:
+    constexpr void factor() noexcept
+    {
+      // L is stored below the diagonal, D on it
+      for (index_t col = 0; col < N; col++)
+      {
+        value_type l_d[N]{};
+        value_type diag = this->m_ld(col, col);
+        for (index_t idx = 0; idx < col; idx++)
+        {
+          l_d[idx] = this->m_ld(col, idx) * this->m_ld(idx, idx);
+          diag -= this->m_ld(col, idx) * l_d[idx];
+        }
+
+        this->m_ld(col, col) = diag;
+        if (!(diag > value_type{ 0 }))
+          this->m_positive_definite = false;
+        if (diag == value_type{ 0 })
+        {
+          this->m_singular = true;
+          continue;
+        }
+
+        for (index_t row = col + 1; row < N; row++)
+        {
+          value_type val = this->m_ld(row, col);
+          for (index_t idx = 0; idx < col; idx++)
+            val -= this->m_ld(row, idx) * l_d[idx];
+          this->m_ld(row, col) = val / diag;
+        }
+      }
+    }
+
+    static_matrix_t<N, N, value_type> m_ld;
+    bool                              m_singular          = false;
+    bool                              m_positive_definite = true;
+  };
+
+  // P * A = L * U with partial pivoting inside the band of A. row swaps widen the band of U to KL + KU diagonals above the main
+  // diagonal; the multipliers of L are kept where the elimination zeroed A, so the factors need N * (2 * KL + KU + 1) elements
+  template <index_t N, index_t KL, index_t KU, typename T> class banded_lu_t
+  {
+  public:
+    using value_type                           = std::remove_cvref_t<T>;
+    static constexpr index_t number_of_rows    = N;
+    static constexpr index_t number_of_columns = N;
+
+    constexpr banded_lu_t(banded_matrix_t<N, KL, KU, T> const& mat) noexcept
+    {
+      for (index_t row = 0; row < N; row++)
+        for (index_t col = mat.first_column(row); col < mat.last_column(row); col++)
+          this->lu(row, col) = mat.element(row, col);
+      this->factor();
+    }
+
+    // true if a zero pivot was met; solve then yields non-finite values
+    constexpr bool is_singular() const noexcept { return this->m_singular; }
+
+    constexpr auto determinant() const noexcept -> value_type
+    {
+      value_type erg = this->m_odd_permutation ? value_type{ -1 } : value_type{ 1 };
+      for (index_t idx = 0; idx < N; idx++)
+        erg *= this->lu(idx, idx);
+      return erg;
+    }
+
+    template <readable_static_matrix_concept Rhs> requires(Rhs::number_of_rows == N) constexpr auto solve(Rhs const& b) const noexcept
+    {
+      constexpr index_t columns = Rhs::number_of_columns;
+
+      static_matrix_t<N, columns, value_type> erg = b;
+
+      // the swaps and eliminations in the order factor() did them
+      for (index_t col = 0; col < N; col++)
+      {
+        index_t const pivot_row = this->m_pivot[col];
+        if (pivot_row != col)
+          for (index_t idx = 0; idx < columns; idx++)
+            std::swap(erg(col, idx), erg(pivot_row, idx));
+
+        for (index_t row = col + 1; row < last_row(col); row++)
+        {
+          value_type const fac = this->lu(row, col);
+          for (index_t idx = 0; idx < columns; idx++)
+            erg(row, idx) -= fac * erg(col, idx);
+        }
+      }
+
+      for (index_t row = N; row-- > 0;)
+      {
+        for (index_t col = row + 1; col < last_column(row); col++)
+        {
+          value_type const fac = this->lu(row, col);
+          for (index_t idx = 0; idx < columns; idx++)
+            erg(row, idx) -= fac * erg(col, idx);
+        }
+
+        value_type const fac = this->lu(row, row);
+        for (index_t idx = 0; idx < columns; idx++)
+          erg(row, idx) /= fac;
+      }
+
+      return erg;
+    }
+
+    constexpr auto inverse() const noexcept { return this->solve(identity_matrix_t<N, N, value_type>()); }
+
+  private:
+    static constexpr index_t width = 2 * KL + KU + 1;
+
+    // rows of L below the pivot of col, columns of U right of the diagonal in row
+    static constexpr index_t last_row(index_t const& col) noexcept { return col + KL + 1 < N ? col + KL + 1 : N; }
+    static constexpr index_t last_column(index_t const& row) noexcept { return row + KL + KU + 1 < N ? row + KL + KU + 1 : N; }
+
+    constexpr auto lu(index_t const& row, index_t const& col) const noexcept -> value_type const& { return this->m_lu[row * width + KL + col - row]; }
+    constexpr auto lu(index_t const& row, index_t const& col) noexcept -> value_type& { return this->m_lu[row * width + KL + col - row]; }
+
+    constexpr void factor() noexcept
+    {
+      for (index_t col = 0; col < N; col++)
+      {
+        index_t sel_idx = col;
+        for (index_t idx = col + 1; idx < last_row(col); idx++)
+          if (Internal::abs(this->lu(sel_idx, col)) < Internal::abs(this->lu(idx, col)))
+            sel_idx = idx;
+
+        this->m_pivot[col] = sel_idx;
+        if (sel_idx != col)
+        {
+          for (index_t idx = col; idx < last_column(col); idx++)
+            std::swap(this->lu(col, idx), this->lu(sel_idx, idx));
+          this->m_odd_permutation = !this->m_odd_permutation;
+        }
+
+        value_type const pivot = this->lu(col, col);
+        if (pivot == value_type{ 0 })
+        {
+          this->m_singular = true;
+          continue;
+        }
+
+        for (index_t row = col + 1; row < last_row(col); row++)
+        {
+          value_type const fac = this->lu(row, col) / pivot;
+
+          this->lu(row, col) = fac;
+          for (index_t idx = col + 1; idx < last_column(col); idx++)
+            this->lu(row, idx) -= fac * this->lu(col, idx);
+        }
+      }
+    }
+
+    value_type m_lu[N * width]{};
+    index_t    m_pivot[N]{};
+    bool       m_odd_permutation = false;
+    bool       m_singular        = false;
+  };
+
+  template <readable_static_matrix_concept Mat> cholesky_t(Mat const&) -> cholesky_t<Mat::number_of_rows, typename Mat::value_type>;
+  template <readable_static_matrix_concept Mat> ldlt_t(Mat const&) -> ldlt_t<Mat::number_of_rows, typename Mat::value_type>;
+}    // namespace ExMath
+
+namespace ExMath
+{
+  template <readable_static_matrix_concept T> requires(T::number_of_rows == T::number_of_columns) constexpr auto inverse(T const& mat)
+  {
+    using value_type = typename T::value_type;
+
+    if constexpr (T::number_of_rows <= Internal::closed_form_max_size)
+    {
+      static_matrix_t<T::number_of_rows, T::number_of_columns, value_type> erg;
+      erg *= value_type{ 1 } / Internal::adjugate(erg, mat);
+      return erg;
+    }
+    else
+    {
+      return lu_factorization_t<T::number_of_rows, value_type>{ mat }.inverse();
+    }
+  }
+
+  // writes the inverse of mat to erg and returns true, or leaves erg untouched and returns false if mat is singular
+  template <readable_static_matrix_concept T, writeable_static_matrix_concept Erg>
+  requires(T::number_of_rows == T::number_of_columns && is_same_size<T, Erg>) constexpr bool try_inverse(T const& mat, Erg& erg)
+  {
+    using value_type = typename T::value_type;
+
+    if constexpr (T::number_of_rows <= Internal::closed_form_max_size)
+    {
+      static_matrix_t<T::number_of_rows, T::number_of_columns, value_type> adj;
+      value_type const det = Internal::adjugate(adj, mat);
+      if (det == value_type{ 0 })
+        return false;
+      erg = adj * (value_type{ 1 } / det);
+      return true;
+    }
+    else
+    {
+      lu_factorization_t<T::number_of_rows, value_type> const lu{ mat };
+      if (lu.is_singular())
+        return false;
+      erg = lu.inverse();
+      return true;
+    }
+  }
+
+  template <readable_static_matrix_concept T> requires(T::number_of_rows == T::number_of_columns) constexpr auto determinant(T const& mat)
+  {
+    using value_type = typename T::value_type;
+
+    if constexpr (T::number_of_rows <= Internal::closed_form_max_size)
+    {
+      return Internal::closed_form_determinant(mat);
+    }
+    else
+    {
+      return lu_factorization_t<T::number_of_rows, value_type>{ mat }.determinant();
+    }
+  }
+
+  template <readable_static_matrix_concept Lhs, readable_static_matrix_concept Rhs>
+  requires(Lhs::number_of_rows == Lhs::number_of_columns && Lhs::number_of_rows == Rhs::number_of_rows) EXMATH_ALWAYS_INLINE constexpr auto
+  solve(Lhs const& mat, Rhs const& b)
+  {
+    using value_type    = typename Lhs::value_type;
+    constexpr index_t N = Lhs::number_of_rows;
+
+    // tiny systems are eliminated as straight-line code in the caller without keeping the factors
+    if constexpr (Internal::unrolled_static_matrix_concept<Lhs> && Internal::unrolled_static_matrix_concept<Rhs>)
+    {
+      static_matrix_t<N, N, value_type>                      val = mat;
+      static_matrix_t<N, Rhs::number_of_columns, value_type> erg = b;
+      Internal::solve(val, erg);
+      return erg;
+    }
+    else
+    {
+      return lu_factorization_t<N, value_type>{ mat }.solve(b);
+    }
+  }
+
+  // diagonal matrices are inverted and solved elementwise; a zero on the diagonal yields non-finite values
+  template <index_t N, typename T> constexpr auto inverse(diagonal_matrix_t<N, T> const& mat) noexcept
+  {
+    using value_type = typename diagonal_matrix_t<N, T>::value_type;
+    diagonal_matrix_t<N, T> erg;
+    for (index_t idx = 0; idx < N; idx++)
+      erg.diagonal(idx) = value_type{ 1 } / mat.diagonal(idx);
+    return erg;
+  }
+
+  template <index_t N, typename T, writeable_static_matrix_concept Erg> requires is_same_size<diagonal_matrix_t<N, T>, Erg>
+  constexpr bool try_inverse(diagonal_matrix_t<N, T> const& mat, Erg& erg)
+  {
+    using value_type = typename diagonal_matrix_t<N, T>::value_type;
+    for (index_t idx = 0; idx < N; idx++)
+      if (mat.diagonal(idx) == value_type{ 0 })
+        return false;
+    erg = inverse(mat);
+    return true;
+  }
+
+  template <index_t N, typename T> constexpr auto determinant(diagonal_matrix_t<N, T> const& mat) noexcept
+  {
+    typename diagonal_matrix_t<N, T>::value_type erg{ 1 };
+    for (index_t idx = 0; idx < N; idx++)
+      erg *= mat.diagonal(idx);
+    return erg;
+  }
+
+  // x with mat * x = b for a triangular mat, by forward or back substitution over all columns of b at once
+  template <index_t N, typename T, triangle_t tri, triangular_storage_t storage, readable_static_matrix_concept Rhs>
+  requires(Rhs::number_of_rows == N) constexpr auto trsm(triangular_matrix_t<N, T, tri, storage> const& mat, Rhs const& b) noexcept
+  {
+    using value_type = typename triangular_matrix_t<N, T, tri, storage>::value_type;
+    static_matrix_t<N, Rhs::number_of_columns, value_type, Internal::preferred_storage_order<Rhs>()> erg = b;
+    if constexpr (tri == triangle_t::lower)
+      Internal::forward_substitution(mat, erg);
+    else
+      Internal::back_substitution(mat, erg);
+    return erg;
+  }
+
+  template <index_t N, typename T, triangle_t tri, triangular_storage_t storage, readable_static_matrix_concept Rhs>
+  requires(Rhs::number_of_rows == N && Rhs::number_of_columns == 1) constexpr auto trsv(triangular_matrix_t<N, T, tri, storage> const& mat,
+                                                                                         Rhs const&                                     b) noexcept
+  {
+    return trsm(mat, b);
+  }
+
+  template <index_t N, typename T, triangle_t tri, triangular_storage_t storage, readable_static_matrix_concept Rhs>
+  requires(Rhs::number_of_rows == N) constexpr auto solve(triangular_matrix_t<N, T, tri, storage> const& mat, Rhs const& b) noexcept
+  {
+    return trsm(mat, b);
+  }
+
+  // the inverse of a triangular matrix is triangular in the same half
+  template <index_t N, typename T, triangle_t tri, triangular_storage_t storage>
+  constexpr auto inverse(triangular_matrix_t<N, T, tri, storage> const& mat) noexcept
+  {
+    using value_type = typename triangular_matrix_t<N, T, tri, storage>::value_type;
+    return triangular_matrix_t<N, T, tri, storage>{ trsm(mat, identity_matrix_t<N, N, value_type>()) };
+  }
+
+  template <index_t N, typename T, triangle_t tri, triangular_storage_t storage>
+  constexpr auto determinant(triangular_matrix_t<N, T, tri, storage> const& mat) noexcept
+  {
+    typename triangular_matrix_t<N, T, tri, storage>::value_type erg{ 1 };
+    for (index_t idx = 0; idx < N; idx++)
+      erg *= mat.element(idx, idx);
+    return erg;
+  }
+
+  template <index_t N, typename T, readable_static_matrix_concept Rhs>
+  requires(Rhs::number_of_rows == N) constexpr auto solve(diagonal_matrix_t<N, T> const& mat, Rhs const& b) noexcept
+  {
+    using value_type = typename diagonal_matrix_t<N, T>::value_type;
+    static_matrix_t<N, Rhs::number_of_columns, value_type, Internal::preferred_storage_order<Rhs>()> erg;
+    Internal::for_each_index<decltype(erg)>([&](index_t const& row, index_t const& col) { erg(row, col) = b(row, col) / mat.diagonal(row); });
+    return erg;
+  }
+
+  // banded systems cost O(N) per column of b: tridiagonal ones by the thomas algorithm, which does not pivot, all others and
+  // tridiagonal ones the thomas algorithm fails on by banded_lu_t
+  template <index_t N, index_t KL, index_t KU, typename T, readable_static_matrix_concept Rhs>
+  requires(Rhs::number_of_rows == N) constexpr auto solve(banded_matrix_t<N, KL, KU, T> const& mat, Rhs const& b) noexcept
+  {
+    if constexpr (KL == 1 && KU == 1)
+    {
+      static_matrix_t<N, Rhs::number_of_columns, typename banded_matrix_t<N, KL, KU, T>::value_type> erg = b;
+      if (!Internal::tridiagonal_solve(mat, erg))
+        erg = banded_lu_t<N, KL, KU, T>{ mat }.solve(b);
+      return erg;
+    }
+    else
+    {
+      return banded_lu_t<N, KL, KU, T>{ mat }.solve(b);
+    }
+  }
+
+  template <index_t N, index_t KL, index_t KU, typename T> constexpr auto inverse(banded_matrix_t<N, KL, KU, T> const& mat) noexcept
+  {
+    return banded_lu_t<N, KL, KU, T>{ mat }.inverse();
+  }
+
+  template <index_t N, index_t KL, index_t KU, typename T> constexpr auto determinant(banded_matrix_t<N, KL, KU, T> const& mat) noexcept
+  {
+    return banded_lu_t<N, KL, KU, T>{ mat }.determinant();
+  }
+}    // namespace ExMath
+
+#endif
@@ -2,13 +2,76 @@
 #ifndef EXMATH_TRAITS_HPP
 #define EXMATH_TRAITS_HPP
 
+#include <inc/ExMath_dispatch.hpp>
 #include <cmath>
 #include <concepts>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <new>
+#include <optional>
 #include <type_traits>
+#include <utility>
+
+// keeps gcc from vectorizing a reduction loop across its unrolled body instead of vectorizing the body itself
+#if defined(__GNUC__) && !defined(__clang__)
+#define EXMATH_NO_LOOP_VECTORIZE __attribute__((optimize("no-tree-loop-vectorize")))
+#else
+#define EXMATH_NO_LOOP_VECTORIZE
+#endif
+
+// keeps the unrolled kernels and the lambdas handed to them in one straight-line function
+#if defined(__GNUC__)
+#define EXMATH_ALWAYS_INLINE __attribute__((always_inline))
+#else
+#define EXMATH_ALWAYS_INLINE
+#endif
+
+// static_matrix_t larger than this many bytes keep their elements on the heap by default
+#ifndef EXMATH_INLINE_STORAGE_MAX_BYTES
+#define EXMATH_INLINE_STORAGE_MAX_BYTES 16384
+#endif
+
+// widest vector register of the target in bytes
+#ifndef EXMATH_SIMD_ALIGNMENT
+#if defined(__AVX512F__)
+#define EXMATH_SIMD_ALIGNMENT 64
+#elif defined(__AVX__)
+#define EXMATH_SIMD_ALIGNMENT 32
+#else
+#define EXMATH_SIMD_ALIGNMENT 16
+#endif
+#endif
+
+// static_matrix_t with at most this many elements get straight-line kernels instead of loops
+#ifndef EXMATH_UNROLL_MAX_ELEMENTS
+#define EXMATH_UNROLL_MAX_ELEMENTS 16
+#endif
+
+// operations on static_matrix_t with at least this many elements are forwarded to the non-template kernels in ExMath.cpp
+#ifndef EXMATH_RUNTIME_KERNEL_MIN_ELEMENTS
+#define EXMATH_RUNTIME_KERNEL_MIN_ELEMENTS 128
+#endif
 
 namespace ExMath
 {
-  using index_t = uint32_t;
+  enum class storage_order_t
+  {
+    row_major,
+    column_major,
+  };
+
+  // where a static_matrix_t keeps its elements
+  struct inline_storage_t    // inside the object
+  {
+  };
+  struct heap_storage_t    // in one heap block owned by the object; copies are deep as for inline storage
+  {
+  };
+  struct external_storage_t    // in a caller owned array; copies refer to the same array, assignment writes into it
+  {
+  };
 }
 
 namespace ExMath
@@ -48,7 +111,7 @@ namespace ExMath
   template <typename T>
   concept writeable_static_matrix_concept = value_type_concept<T> && static_matrix_size_concept<T> && writeable_like_matrix_concept<T, typename T::value_type>;
 
-  template <static_matrix_size_concept T> constexpr bool is_scalar = T::number_of_rows == 1 && T::number_of_columns;
+  template <static_matrix_size_concept T> constexpr bool is_scalar = T::number_of_rows == 1 && T::number_of_columns == 1;
 
   template <static_matrix_size_concept T1, static_matrix_size_concept T2>
   constexpr bool is_same_size = T1::number_of_rows == T2::number_of_rows && T1::number_of_columns == T2::number_of_columns;
@@ -57,6 +120,123 @@ namespace ExMath
   concept is_assignable = writeable_static_matrix_concept<Erg> && (readable_static_matrix_concept<Val> && is_same_size<Erg, Val>) ||
                           (!readable_static_matrix_concept<Val> && readable_like_matrix_concept<Val, typename Erg::value_type>);
 
+  template <typename T> concept storage_order_concept = requires()
+  {
+    {
+      T::storage_order
+    } -> std::convertible_to<storage_order_t>;
+  };
+
+  // matrices whose elements lie in one buffer in the order given by storage_order, consecutive rows (row major) or columns
+  // (column major) starting stride() elements apart, with the stride only known at runtime
+  template <typename T>
+  concept runtime_strided_matrix_concept = readable_static_matrix_concept<T> && storage_order_concept<T> && requires(T const& obj)
+  {
+    {
+      obj.data()
+    } -> std::convertible_to<typename T::value_type const*>;
+    {
+      obj.stride()
+    } -> std::convertible_to<index_t>;
+  };
+
+  // matrices whose elements lie in one buffer in the order given by storage_order, consecutive rows (row major) or columns
+  // (column major) starting leading_dimension elements apart; without a leading_dimension member they are densely packed
+  template <typename T>
+  concept strided_static_matrix_concept = readable_static_matrix_concept<T> && storage_order_concept<T> && !runtime_strided_matrix_concept<T> &&
+                                          requires(T const& obj)
+  {
+    {
+      obj.data()
+    } -> std::convertible_to<typename T::value_type const*>;
+  };
+
+  // matrices in one buffer with a compile-time or runtime stride
+  template <typename T> concept in_memory_matrix_concept = strided_static_matrix_concept<T> || runtime_strided_matrix_concept<T>;
+
+  namespace Internal
+  {
+    template <typename T> constexpr index_t dense_leading_dimension() noexcept
+    {
+      if constexpr (storage_order_concept<T>)
+        return T::storage_order == storage_order_t::column_major ? T::number_of_rows : T::number_of_columns;
+      else
+        return T::number_of_columns;
+    }
+
+    template <typename T> constexpr index_t leading_dimension() noexcept
+    {
+      if constexpr (requires { T::leading_dimension; })
+        return T::leading_dimension;
+      else
+        return dense_leading_dimension<T>();
+    }
+  }    // namespace Internal
+
+  // strided matrices without padding: all number_of_elements elements are consecutive in data()
+  template <typename T>
+  concept contiguous_static_matrix_concept = strided_static_matrix_concept<T> &&(Internal::leading_dimension<T>() == Internal::dense_leading_dimension<T>());
+
+  // unevaluated results of matrix arithmetic, see elementwise_expression_t
+  template <typename T> concept lazy_expression_concept = readable_static_matrix_concept<T> && T::is_lazy_expression;
+
+  template <typename T1, typename T2>
+  concept same_contiguous_layout = contiguous_static_matrix_concept<T1> && contiguous_static_matrix_concept<T2> && (T1::storage_order == T2::storage_order);
+
+  template <readable_static_matrix_concept T> class transpose_view_t;
+
+  template <typename T> constexpr bool is_transpose_view = false;
+  template <typename T> constexpr bool is_transpose_view<transpose_view_t<T>> = true;
+
+  template <index_t rows, index_t columns, typename T> class identity_matrix_t;
+  template <index_t rows, index_t columns, typename T> class zero_matrix_t;
+  template <index_t N, typename T> class diagonal_matrix_t;
+
+  enum class triangle_t
+  {
+    lower,
+    upper,
+  };
+
+  // packed keeps the n * (n + 1) / 2 elements of the triangle; full keeps all n * n elements but never reads the other
+  // triangle, e.g. to use the lower half of a buffer that holds something else above the diagonal
+  enum class triangular_storage_t
+  {
+    packed,
+    full,
+  };
+
+  template <index_t N, typename T, triangle_t tri, triangular_storage_t storage> class triangular_matrix_t;
+  template <index_t N, typename T> class symmetric_matrix_t;
+  template <index_t N, index_t KL, index_t KU, typename T> class banded_matrix_t;
+  template <typename Op, typename Val, typename Diag> class diagonal_shift_expression_t;
+
+  // structural matrices the operators fold at compile time instead of reading them element by element
+  template <typename T> constexpr bool is_identity_matrix = false;
+  template <index_t rows, index_t columns, typename T> constexpr bool is_identity_matrix<identity_matrix_t<rows, columns, T>> = true;
+  template <typename T> constexpr bool is_zero_matrix = false;
+  template <index_t rows, index_t columns, typename T> constexpr bool is_zero_matrix<zero_matrix_t<rows, columns, T>> = true;
+  template <typename T> constexpr bool is_diagonal_matrix = false;
+  template <index_t N, typename T> constexpr bool is_diagonal_matrix<diagonal_matrix_t<N, T>> = true;
+  template <typename T> constexpr bool is_triangular_matrix = false;
+  template <index_t N, typename T, triangle_t tri, triangular_storage_t storage>
+  constexpr bool is_triangular_matrix<triangular_matrix_t<N, T, tri, storage>> = true;
+  template <typename Lhs, typename Rhs> constexpr bool is_same_triangle = false;
+  template <index_t N, typename T1, typename T2, triangle_t tri, triangular_storage_t s1, triangular_storage_t s2>
+  constexpr bool is_same_triangle<triangular_matrix_t<N, T1, tri, s1>, triangular_matrix_t<N, T2, tri, s2>> = true;
+  template <typename T> constexpr bool is_symmetric_matrix = false;
+  template <index_t N, typename T> constexpr bool is_symmetric_matrix<symmetric_matrix_t<N, T>> = true;
+  template <typename T> constexpr bool is_banded_matrix = false;
+  template <index_t N, index_t KL, index_t KU, typename T> constexpr bool is_banded_matrix<banded_matrix_t<N, KL, KU, T>> = true;
+  template <typename T> constexpr bool is_diagonal_shift = false;
+  template <typename Op, typename Val, typename Diag> constexpr bool is_diagonal_shift<diagonal_shift_expression_t<Op, Val, Diag>> = true;
+
+  // nonzero only on the main diagonal, so sums with it only touch the diagonal of the other operand
+  template <typename T> constexpr bool is_diagonal_structure = is_identity_matrix<T> || is_diagonal_matrix<T>;
+
+  // equal to their transpose by construction, so sums of them are symmetric as well
+  template <typename T> constexpr bool is_symmetric_structure = is_symmetric_matrix<T> || is_diagonal_structure<T>;
+
 }    // namespace ExMath
 
 namespace ExMath
@@ -71,290 +251,2001 @@ namespace ExMath
     {
       return col * rows + row;
     }
+    template <storage_order_t order, index_t leading_dimension> constexpr index_t calc_index_strided(index_t const& row, index_t const& col) noexcept
+    {
+      if constexpr (order == storage_order_t::column_major)
+        return col * leading_dimension + row;
+      else
+        return row * leading_dimension + col;
+    }
+    template <storage_order_t order, index_t rows, index_t columns> constexpr index_t calc_index(index_t const& row, index_t const& col) noexcept
+    {
+      if constexpr (order == storage_order_t::column_major)
+        return calc_index_col_major<rows, columns>(row, col);
+      else
+        return calc_index_row_major<rows, columns>(row, col);
+    }
+
+    // <cmath> is not usable in constant expressions before c++23, these fall back to it at runtime only
+    template <typename T> constexpr T abs(T const& val) noexcept { return val < T{ 0 } ? -val : val; }
+
+    template <typename T> constexpr T sqrt(T const& val) noexcept
+    {
+      if (!std::is_constant_evaluated())
+        return std::sqrt(val);
+
+      if (val < T{ 0 } || val != val)
+        return std::numeric_limits<T>::quiet_NaN();
+      if (val == T{ 0 } || val == std::numeric_limits<T>::infinity())
+        return val;
+
+      // newton iteration from above converges monotonically, stop once it no longer decreases
+      T erg = val < T{ 1 } ? T{ 1 } : val;
+      while (true)
+      {
+        T const next = (erg + val / erg) / T{ 2 };
+        if (!(next < erg))
+          return erg;
+        erg = next;
+      }
+    }
+
+    template <typename T> constexpr T log(T const& val) noexcept
+    {
+      if (!std::is_constant_evaluated())
+        return std::log(val);
+
+      if (val < T{ 0 } || val != val)
+        return std::numeric_limits<T>::quiet_NaN();
+      if (val == T{ 0 })
+        return -std::numeric_limits<T>::infinity();
+      if (val == std::numeric_limits<T>::infinity())
+        return val;
+
+      // val = mantissa * 2^exponent with mantissa in [0.5, 1), then log(mantissa) = 2 * atanh((mantissa - 1) / (mantissa + 1))
+      constexpr T ln2      = T{ 0.693147180559945309417232121458176568L };
+      T           mantissa = val;
+      int         exponent = 0;
+      while (mantissa >= T{ 1 })
+      {
+        mantissa /= T{ 2 };
+        exponent++;
+      }
+      while (mantissa < T{ 0.5 })
+      {
+        mantissa *= T{ 2 };
+        exponent--;
+      }
+
+      T const z    = (mantissa - T{ 1 }) / (mantissa + T{ 1 });
+      T const z2   = z * z;
+      T       term = z;
+      T       sum  = T{ 0 };
+      for (int idx = 1; sum + term / T(idx) != sum; idx += 2)
+      {
+        sum += term / T(idx);
+        term *= z2;
+      }
+      return T{ 2 } * sum + T(exponent) * ln2;
+    }
+
+    template <typename T> constexpr storage_order_t transposed_storage_order() noexcept
+    {
+      if constexpr (storage_order_concept<T>)
+        return T::storage_order == storage_order_t::row_major ? storage_order_t::column_major : storage_order_t::row_major;
+      else
+        return storage_order_t::row_major;
+    }
+
+    // storage order for a result computed from the given operands: the first one that has an order wins
+    template <typename T, typename... Ts> constexpr storage_order_t preferred_storage_order() noexcept
+    {
+      if constexpr (storage_order_concept<T>)
+        return T::storage_order;
+      else if constexpr (sizeof...(Ts) != 0)
+        return preferred_storage_order<Ts...>();
+      else
+        return storage_order_t::row_major;
+    }
+
+    // distance in the buffer between consecutive rows (row major) or columns (column major) of a matrix in memory
+    template <in_memory_matrix_concept T> constexpr index_t stride_of(T const& obj) noexcept
+    {
+      if constexpr (runtime_strided_matrix_concept<T>)
+        return obj.stride();
+      else
+        return leading_dimension<T>();
+    }
+
+    template <in_memory_matrix_concept T> constexpr index_t row_stride_of(T const& obj) noexcept
+    {
+      return T::storage_order == storage_order_t::row_major ? stride_of(obj) : 1;
+    }
+
+    template <in_memory_matrix_concept T> constexpr index_t column_stride_of(T const& obj) noexcept
+    {
+      return T::storage_order == storage_order_t::row_major ? 1 : stride_of(obj);
+    }
+
+    // number of elements from data() up to and including the last element of a matrix in memory
+    template <in_memory_matrix_concept T> constexpr index_t buffer_extent(T const& obj) noexcept
+    {
+      constexpr index_t outer = T::storage_order == storage_order_t::row_major ? T::number_of_rows : T::number_of_columns;
+      constexpr index_t inner = T::storage_order == storage_order_t::row_major ? T::number_of_columns : T::number_of_rows;
+      return (outer - 1) * stride_of(obj) + inner;
+    }
+
+    // true if the buffers spanned by two matrices in memory share memory; views make this more than a comparison of data().
+    // unrelated pointers cannot be ordered in constant expressions, there any two buffers are assumed to overlap
+    template <in_memory_matrix_concept A, in_memory_matrix_concept B> constexpr bool overlaps(A const& a, B const& b) noexcept
+    {
+      if (std::is_constant_evaluated())
+        return true;
+
+      void const* a_first = a.data();
+      void const* a_last  = a.data() + buffer_extent(a);
+      void const* b_first = b.data();
+      void const* b_last  = b.data() + buffer_extent(b);
+      return std::less<void const*>{}(a_first, b_last) && std::less<void const*>{}(b_first, a_last);
+    }
+
+    // true if obj reads from the buffer erg writes to
+    template <typename T, typename Erg> constexpr bool references(T const& obj, Erg const& erg) noexcept
+    {
+      if constexpr (in_memory_matrix_concept<T> && in_memory_matrix_concept<Erg>)
+        return overlaps(obj, erg);
+      else if constexpr (requires { obj.references(erg); })
+        return obj.references(erg);
+      else
+        return false;
+    }
+
+    // true if obj reads from the buffer erg writes to at other positions than the ones it is evaluated at
+    template <typename T, typename Erg> constexpr bool reads_displaced(T const& obj, Erg const& erg) noexcept
+    {
+      if constexpr (in_memory_matrix_concept<T>)
+        return overlaps(obj, erg) && !(static_cast<void const*>(obj.data()) == static_cast<void const*>(erg.data()) &&
+                                       T::storage_order == Erg::storage_order && stride_of(obj) == stride_of(erg));
+      else if constexpr (requires { obj.reads_displaced(erg); })
+        return obj.reads_displaced(erg);
+      else
+        return false;
+    }
+
+    // true if writing val into erg element by element could overwrite elements val still has to read
+    template <typename Erg, typename Val> constexpr bool is_aliased(Erg const& erg, Val const& val) noexcept
+    {
+      if constexpr (in_memory_matrix_concept<Erg>)
+        return reads_displaced(val, erg);
+      else
+        return false;
+    }
+
+    // true if val reads from the buffer erg writes to
+    template <typename Erg, typename Val> constexpr bool is_overlapping(Erg const& erg, Val const& val) noexcept
+    {
+      if constexpr (in_memory_matrix_concept<Erg>)
+        return references(val, erg);
+      else
+        return false;
+    }
+
+    // operands of expressions are referenced if they are lvalues and held by value if they are temporaries
+    template <typename T>
+    using expression_operand_t = std::conditional_t<std::is_lvalue_reference_v<T>, std::remove_reference_t<T> const&, std::remove_cvref_t<T>>;
+
+    struct add_op_t
+    {
+      template <typename T> static constexpr auto apply(T const& lhs, T const& rhs) noexcept -> T { return lhs + rhs; }
+    };
+
+    struct sub_op_t
+    {
+      template <typename T> static constexpr auto apply(T const& lhs, T const& rhs) noexcept -> T { return lhs - rhs; }
+    };
+
+    struct mul_op_t
+    {
+      template <typename T> static constexpr auto apply(T const& lhs, T const& rhs) noexcept -> T { return lhs * rhs; }
+    };
+
+    struct div_op_t
+    {
+      template <typename T> static constexpr auto apply(T const& lhs, T const& rhs) noexcept -> T { return lhs / rhs; }
+    };
+
+    template <typename T> concept unrolled_static_matrix_concept = T::number_of_elements <= EXMATH_UNROLL_MAX_ELEMENTS;
+
+    template <typename Fnc, index_t... idx> EXMATH_ALWAYS_INLINE constexpr void unroll(Fnc& fnc, std::integer_sequence<index_t, idx...>)
+    {
+      (fnc(idx), ...);
+    }
+
+    // calls fnc(idx) for idx = 0 .. count - 1 in order; as a fold expression if unrolled, so no loop is left to the optimizer
+    template <index_t count, bool unrolled, typename Fnc> EXMATH_ALWAYS_INLINE constexpr void static_for(Fnc&& fnc)
+    {
+      if constexpr (unrolled)
+      {
+        Internal::unroll(fnc, std::make_integer_sequence<index_t, count>{});
+      }
+      else
+      {
+        for (index_t idx = 0; idx < count; idx++)
+          fnc(idx);
+      }
+    }
+
+    // visits every element of the buffer of a contiguous Erg
+    template <static_matrix_size_concept Erg, typename Fnc> constexpr void for_each_element(Fnc&& fnc)
+    {
+      static_for<Erg::number_of_elements, unrolled_static_matrix_concept<Erg>>(fnc);
+    }
+
+    // visits every (row, col) of Erg so that the innermost loop walks its storage with unit stride
+    template <static_matrix_size_concept Erg, typename Fnc> constexpr void for_each_index(Fnc&& fnc)
+    {
+      if constexpr (unrolled_static_matrix_concept<Erg>)
+      {
+        for_each_element<Erg>(
+            [&](index_t const& idx)
+            {
+              if constexpr (preferred_storage_order<Erg>() == storage_order_t::column_major)
+                fnc(idx % Erg::number_of_rows, idx / Erg::number_of_rows);
+              else
+                fnc(idx / Erg::number_of_columns, idx % Erg::number_of_columns);
+            });
+      }
+      else if constexpr (preferred_storage_order<Erg>() == storage_order_t::column_major)
+      {
+        for (index_t col = 0; col < Erg::number_of_columns; col++)
+          for (index_t row = 0; row < Erg::number_of_rows; row++)
+            fnc(row, col);
+      }
+      else
+      {
+        for (index_t row = 0; row < Erg::number_of_rows; row++)
+          for (index_t col = 0; col < Erg::number_of_columns; col++)
+            fnc(row, col);
+      }
+    }
+
+    // visits (idx, idx) of Erg for every idx on its main diagonal
+    template <static_matrix_size_concept Erg, typename Fnc> constexpr void for_each_diagonal(Fnc&& fnc)
+    {
+      constexpr index_t count = Erg::number_of_rows < Erg::number_of_columns ? Erg::number_of_rows : Erg::number_of_columns;
+      static_for<count, unrolled_static_matrix_concept<Erg>>(fnc);
+    }
+
+    // visits every element of the packed buffer of a triangular or symmetric Erg
+    template <static_matrix_size_concept Erg, typename Fnc> constexpr void for_each_stored(Fnc&& fnc)
+    {
+      static_for<Erg::number_of_stored_elements, unrolled_static_matrix_concept<Erg>>(fnc);
+    }
+
+    // float and double operands in memory of which at least one reaches EXMATH_RUNTIME_KERNEL_MIN_ELEMENTS are handed to the
+    // non-template kernels in ExMath.cpp as pointer + strides, instead of instantiating the loops for every size once more.
+    // operands with a runtime stride only reach the fast kernels this way
+    template <typename Erg, typename... Ts>
+    concept runtime_kernel_concept = runtime_value_type<typename Erg::value_type> && in_memory_matrix_concept<Erg> &&
+                                     (in_memory_matrix_concept<Ts> && ...) &&
+                                     (std::is_same_v<std::remove_cv_t<typename Ts::value_type>, typename Erg::value_type> && ...) &&
+                                     ((Erg::number_of_elements >= EXMATH_RUNTIME_KERNEL_MIN_ELEMENTS) || ... ||
+                                      (Ts::number_of_elements >= EXMATH_RUNTIME_KERNEL_MIN_ELEMENTS));
 
     template <writeable_static_matrix_concept Erg, typename Val>
     requires readable_like_matrix_concept<Val, typename Erg::value_type> constexpr void assign(Erg& erg, Val const& rhs)
     {
-      for (index_t col = 0; col < Erg::number_of_columns; col++)
-        for (index_t row = 0; row < Erg::number_of_rows; row++)
-          erg(row, col) = rhs(row, col);
+      using T = typename Erg::value_type;
+      if constexpr (is_diagonal_shift<Val>)
+      {
+        // the operand is copied the fast way, the diagonal part only touches the diagonal
+        assign(erg, rhs.operand());
+        for_each_diagonal<Erg>([&](index_t const& idx)
+                               { erg(idx, idx) = Val::operation_type::template apply<T>(erg(idx, idx), rhs.diagonal_operand()(idx, idx)); });
+      }
+      else if constexpr (same_contiguous_layout<Erg, Val>)
+      {
+        auto*       dst = erg.data();
+        auto const* src = rhs.data();
+        for_each_element<Erg>([&](index_t const& idx) { dst[idx] = src[idx]; });
+      }
+      else
+      {
+        for_each_index<Erg>([&](index_t const& row, index_t const& col) { erg(row, col) = rhs(row, col); });
+      }
+    }
+
+    template <writeable_static_matrix_concept Erg, typename Val>
+    requires readable_like_matrix_concept<Val, typename Erg::value_type> constexpr void add_assign(Erg& erg, Val const& rhs)
+    {
+      if constexpr (is_zero_matrix<Val>)
+      {
+      }
+      else if constexpr (is_diagonal_structure<Val>)
+      {
+        for_each_diagonal<Erg>([&](index_t const& idx) { erg(idx, idx) += rhs(idx, idx); });
+      }
+      else if constexpr (same_contiguous_layout<Erg, Val>)
+      {
+        auto*       dst = erg.data();
+        auto const* src = rhs.data();
+        if constexpr (runtime_kernel_concept<Erg, Val>)
+        {
+          if (!std::is_constant_evaluated())
+          {
+            runtime_add(dst, dst, src, Erg::number_of_elements);
+            return;
+          }
+        }
+        for_each_element<Erg>([&](index_t const& idx) { dst[idx] += src[idx]; });
+      }
+      else
+      {
+        for_each_index<Erg>([&](index_t const& row, index_t const& col) { erg(row, col) += rhs(row, col); });
+      }
+    }
+
+    template <writeable_static_matrix_concept Erg, typename Val>
+    requires readable_like_matrix_concept<Val, typename Erg::value_type> constexpr void sub_assign(Erg& erg, Val const& rhs)
+    {
+      if constexpr (is_zero_matrix<Val>)
+      {
+      }
+      else if constexpr (is_diagonal_structure<Val>)
+      {
+        for_each_diagonal<Erg>([&](index_t const& idx) { erg(idx, idx) -= rhs(idx, idx); });
+      }
+      else if constexpr (same_contiguous_layout<Erg, Val>)
+      {
+        auto*       dst = erg.data();
+        auto const* src = rhs.data();
+        if constexpr (runtime_kernel_concept<Erg, Val>)
+        {
+          if (!std::is_constant_evaluated())
+          {
+            runtime_sub(dst, dst, src, Erg::number_of_elements);
+            return;
+          }
+        }
+        for_each_element<Erg>([&](index_t const& idx) { dst[idx] -= src[idx]; });
+      }
+      else
+      {
+        for_each_index<Erg>([&](index_t const& row, index_t const& col) { erg(row, col) -= rhs(row, col); });
+      }
+    }
+
+    template <writeable_static_matrix_concept Erg, typename Val> constexpr void mult_assign(Erg& erg, Val const& val)
+    {
+      if constexpr (contiguous_static_matrix_concept<Erg>)
+      {
+        auto* dst = erg.data();
+        for_each_element<Erg>([&](index_t const& idx) { dst[idx] *= val; });
+      }
+      else
+      {
+        for_each_index<Erg>([&](index_t const& row, index_t const& col) { erg(row, col) *= val; });
+      }
+    }
+
+    template <writeable_static_matrix_concept Erg, typename Val> constexpr void div_assign(Erg& erg, Val const& rhs)
+    {
+      if constexpr (contiguous_static_matrix_concept<Erg>)
+      {
+        auto* dst = erg.data();
+        for_each_element<Erg>([&](index_t const& idx) { dst[idx] /= rhs; });
+      }
+      else
+      {
+        for_each_index<Erg>([&](index_t const& row, index_t const& col) { erg(row, col) /= rhs; });
+      }
+    }
+
+    template <writeable_static_matrix_concept Erg, typename Lhs, typename Rhs>
+    requires readable_like_matrix_concept<Lhs, typename Erg::value_type>&& readable_like_matrix_concept<Rhs, typename Erg::value_type> constexpr void
+                                                                           add(Erg& erg, Lhs const& lhs, Rhs const& rhs)
+    {
+      if constexpr (same_contiguous_layout<Erg, Lhs> && same_contiguous_layout<Erg, Rhs>)
+      {
+        auto*       dst = erg.data();
+        auto const* a   = lhs.data();
+        auto const* b   = rhs.data();
+        if constexpr (runtime_kernel_concept<Erg, Lhs, Rhs>)
+        {
+          if (!std::is_constant_evaluated())
+          {
+            runtime_add(dst, a, b, Erg::number_of_elements);
+            return;
+          }
+        }
+        for_each_element<Erg>([&](index_t const& idx) { dst[idx] = a[idx] + b[idx]; });
+      }
+      else
+      {
+        for_each_index<Erg>([&](index_t const& row, index_t const& col) { erg(row, col) = lhs(row, col) + rhs(row, col); });
+      }
+    }
+
+    template <writeable_static_matrix_concept Erg, typename Lhs, typename Rhs>
+    requires readable_like_matrix_concept<Lhs, typename Erg::value_type>&& readable_like_matrix_concept<Rhs, typename Erg::value_type> constexpr void
+                                                                           sub(Erg& erg, Lhs const& lhs, Rhs const& rhs)
+    {
+      if constexpr (same_contiguous_layout<Erg, Lhs> && same_contiguous_layout<Erg, Rhs>)
+      {
+        auto*       dst = erg.data();
+        auto const* a   = lhs.data();
+        auto const* b   = rhs.data();
+        if constexpr (runtime_kernel_concept<Erg, Lhs, Rhs>)
+        {
+          if (!std::is_constant_evaluated())
+          {
+            runtime_sub(dst, a, b, Erg::number_of_elements);
+            return;
+          }
+        }
+        for_each_element<Erg>([&](index_t const& idx) { dst[idx] = a[idx] - b[idx]; });
+      }
+      else
+      {
+        for_each_index<Erg>([&](index_t const& row, index_t const& col) { erg(row, col) = lhs(row, col) - rhs(row, col); });
+      }
     }
 
-    template <writeable_static_matrix_concept Erg, typename Val>
-    requires readable_like_matrix_concept<Val, typename Erg::value_type> constexpr void add_assign(Erg& erg, Val const& rhs)
+    // distance in the buffer between two neighbouring rows / columns of a strided matrix
+    template <strided_static_matrix_concept T>
+    constexpr index_t row_stride = T::storage_order == storage_order_t::row_major ? leading_dimension<T>() : 1;
+    template <strided_static_matrix_concept T>
+    constexpr index_t column_stride = T::storage_order == storage_order_t::row_major ? 1 : leading_dimension<T>();
+
+    // size of the block of the result the gemm micro kernel keeps in registers; below min_depth the
+    // compiler fully unrolls and vectorizes the reference loop, which then beats the blocked kernel
+    template <typename T> struct gemm_tile_t
+    {
+      static constexpr index_t rows      = 1;
+      static constexpr index_t columns   = 1;
+      static constexpr index_t min_depth = 0;
+    };
+    template <> struct gemm_tile_t<float>
+    {
+      static constexpr index_t rows      = 2;
+      static constexpr index_t columns   = 8;
+      static constexpr index_t min_depth = 17;
+    };
+    template <> struct gemm_tile_t<double>
+    {
+      static constexpr index_t rows      = 2;
+      static constexpr index_t columns   = 8;
+      static constexpr index_t min_depth = 17;
+    };
+
+    template <typename Lhs>
+    concept gemm_tiled_concept = gemm_tile_t<typename Lhs::value_type>::rows * gemm_tile_t<typename Lhs::value_type>::columns > 1 &&
+                                 Lhs::number_of_columns >= gemm_tile_t<typename Lhs::value_type>::min_depth;
+
+    // erg = alpha * acc + beta * erg, where erg is not read if beta is zero
+    template <typename T> constexpr void gemm_store(T& erg, T const& alpha, T const& acc, T const& beta) noexcept
+    {
+      if (beta == T{ 0 })
+        erg = alpha * acc;
+      else
+        erg = alpha * acc + beta * erg;
+    }
+
+    // computes the tile_rows x tile_columns block of erg at (row, col) with all partial sums held in locals
+    template <index_t tile_rows, index_t tile_columns, typename Erg, typename Lhs, typename Rhs>
+    EXMATH_NO_LOOP_VECTORIZE constexpr void gemm_tile(Erg&                            erg,
+                                                      typename Erg::value_type const& alpha,
+                                                      Lhs const&                      lhs,
+                                                      Rhs const&                      rhs,
+                                                      typename Erg::value_type const& beta,
+                                                      index_t const&                  row,
+                                                      index_t const&                  col)
+    {
+      using T = typename Erg::value_type;
+
+      T const* a = lhs.data() + row * row_stride<Lhs>;
+      T const* b = rhs.data() + col * column_stride<Rhs>;
+      T*       c = erg.data() + row * row_stride<Erg> + col * column_stride<Erg>;
+
+      T acc[tile_rows][tile_columns]{};
+      for (index_t idx = 0; idx < Lhs::number_of_columns; idx++)
+        for (index_t i = 0; i < tile_rows; i++)
+        {
+          T const a_val = a[i * row_stride<Lhs> + idx * column_stride<Lhs>];
+          for (index_t j = 0; j < tile_columns; j++)
+            acc[i][j] += a_val * b[idx * row_stride<Rhs> + j * column_stride<Rhs>];
+        }
+
+      for (index_t i = 0; i < tile_rows; i++)
+        for (index_t j = 0; j < tile_columns; j++)
+          gemm_store(c[i * row_stride<Erg> + j * column_stride<Erg>], alpha, acc[i][j], beta);
+    }
+
+    template <typename Erg, typename Lhs, typename Rhs>
+    constexpr void gemm_blocked(Erg& erg, typename Erg::value_type const& alpha, Lhs const& lhs, Rhs const& rhs, typename Erg::value_type const& beta)
+    {
+      using tile_t                   = gemm_tile_t<typename Erg::value_type>;
+      constexpr index_t M            = Erg::number_of_rows;
+      constexpr index_t N            = Erg::number_of_columns;
+      constexpr index_t tile_rows    = tile_t::rows < M ? tile_t::rows : M;
+      constexpr index_t tile_columns = tile_t::columns < N ? tile_t::columns : N;
+      constexpr index_t full_rows    = M - M % tile_rows;
+      constexpr index_t full_columns = N - N % tile_columns;
+
+      for (index_t row = 0; row < full_rows; row += tile_rows)
+      {
+        for (index_t col = 0; col < full_columns; col += tile_columns)
+          gemm_tile<tile_rows, tile_columns>(erg, alpha, lhs, rhs, beta, row, col);
+        for (index_t col = full_columns; col < N; col++)
+          gemm_tile<tile_rows, 1>(erg, alpha, lhs, rhs, beta, row, col);
+      }
+      for (index_t row = full_rows; row < M; row++)
+      {
+        for (index_t col = 0; col < full_columns; col += tile_columns)
+          gemm_tile<1, tile_columns>(erg, alpha, lhs, rhs, beta, row, col);
+        for (index_t col = full_columns; col < N; col++)
+          gemm_tile<1, 1>(erg, alpha, lhs, rhs, beta, row, col);
+      }
+    }
+
+    template <writeable_static_matrix_concept Erg, typename Lhs, typename Rhs>
+    requires readable_like_matrix_concept<Lhs, typename Erg::value_type>&& readable_like_matrix_concept<Rhs, typename Erg::value_type> constexpr void
+    gemm_reference(Erg& erg, typename Erg::value_type const& alpha, Lhs const& lhs, Rhs const& rhs, typename Erg::value_type const& beta)
+    {
+      using T = typename Erg::value_type;
+      for_each_index<Erg>(
+          [&](index_t const& row, index_t const& col)
+          {
+            T tmp = 0;
+            static_for<Lhs::number_of_columns, unrolled_static_matrix_concept<Erg> && unrolled_static_matrix_concept<Lhs>>(
+                [&](index_t const& idx) { tmp += lhs(row, idx) * rhs(idx, col); });
+            gemm_store(erg(row, col), alpha, tmp, beta);
+          });
+    }
+
+    // the kernels read rhs along its rows; one in memory the other way round, a transposed operand above all, is copied into row
+    // major order first as long as the copy fits on the stack. tiny sizes are straight-line code where the order does not matter
+    template <typename Rhs>
+    concept gemm_packed_concept = in_memory_matrix_concept<Rhs> && Rhs::storage_order == storage_order_t::column_major && Rhs::number_of_rows > 1 &&
+                                  Rhs::number_of_columns > 1 && !unrolled_static_matrix_concept<Rhs> &&
+                                  Rhs::number_of_elements * sizeof(typename Rhs::value_type) <= EXMATH_INLINE_STORAGE_MAX_BYTES;
+
+    // a symmetric operand is unpacked into a dense copy as long as the copy fits on the stack
+    template <typename T>
+    concept symmetric_unpack_concept = is_symmetric_matrix<T> && T::number_of_elements * sizeof(typename T::value_type) <= EXMATH_INLINE_STORAGE_MAX_BYTES;
+
+    template <typename Rhs> struct packed_rhs_t
+    {
+      using value_type                                    = std::remove_cv_t<typename Rhs::value_type>;
+      static constexpr index_t         number_of_rows     = Rhs::number_of_rows;
+      static constexpr index_t         number_of_columns  = Rhs::number_of_columns;
+      static constexpr index_t         number_of_elements = Rhs::number_of_elements;
+      static constexpr storage_order_t storage_order      = storage_order_t::row_major;
+
+      constexpr explicit packed_rhs_t(Rhs const& rhs) noexcept
+      {
+        for_each_index<Rhs>([&](index_t const& row, index_t const& col) { this->m_data[row * number_of_columns + col] = rhs(row, col); });
+      }
+
+      constexpr auto operator()(index_t const& row, index_t const& col) const noexcept -> value_type const&
+      {
+        return this->m_data[row * number_of_columns + col];
+      }
+      constexpr auto data() const noexcept -> value_type const* { return this->m_data; }
+
+      value_type m_data[number_of_elements]{};
+    };
+
+    // erg written through its transpose, see gemm
+    template <typename Erg> struct transposed_target_t
+    {
+      using value_type                                    = typename Erg::value_type;
+      static constexpr index_t         number_of_rows     = Erg::number_of_columns;
+      static constexpr index_t         number_of_columns  = Erg::number_of_rows;
+      static constexpr index_t         number_of_elements = Erg::number_of_elements;
+      static constexpr storage_order_t storage_order      = transposed_storage_order<Erg>();
+      static constexpr index_t         leading_dimension  = Internal::leading_dimension<Erg>();
+
+      constexpr auto operator()(index_t const& row, index_t const& col) const noexcept -> value_type const& { return std::as_const(this->m_erg)(col, row); }
+      constexpr auto operator()(index_t const& row, index_t const& col) noexcept -> value_type& { return this->m_erg(col, row); }
+      constexpr auto data() const noexcept -> value_type const* { return std::as_const(this->m_erg).data(); }
+      constexpr auto data() noexcept -> value_type* { return this->m_erg.data(); }
+
+      Erg& m_erg;
+    };
+
+    // erg = alpha * lhs * rhs + beta * erg with a diagonal lhs or rhs, which scales the rows of rhs or the columns of lhs
+    template <writeable_static_matrix_concept Erg, typename Lhs, typename Rhs>
+    constexpr void diagonal_mult(Erg& erg, typename Erg::value_type const& alpha, Lhs const& lhs, Rhs const& rhs, typename Erg::value_type const& beta)
+    {
+      if constexpr (is_diagonal_matrix<Lhs>)
+        for_each_index<Erg>([&](index_t const& row, index_t const& col) { gemm_store(erg(row, col), alpha, lhs.diagonal(row) * rhs(row, col), beta); });
+      else
+        for_each_index<Erg>([&](index_t const& row, index_t const& col) { gemm_store(erg(row, col), alpha, lhs(row, col) * rhs.diagonal(col), beta); });
+    }
+
+    // below this many elements of erg the dense loops, which the compiler unrolls, beat skipping the zero half of a triangle
+    constexpr index_t triangular_min_elements = 100;
+
+    // element (row, col) of obj; triangular and banded matrices are read without checking for their zeros, the caller stays
+    // inside the triangle or band
+    template <typename T> constexpr decltype(auto) stored(T const& obj, index_t const& row, index_t const& col) noexcept
+    {
+      if constexpr (is_triangular_matrix<T> || is_banded_matrix<T>)
+        return obj.element(row, col);
+      else
+        return obj(row, col);
+    }
+
+    // width columns of row of erg = alpha * lhs * rhs + beta * erg for a triangular lhs and a dense rhs; accumulates the rows of
+    // rhs in locals, which keeps the inner loop contiguous
+    template <index_t width, typename Erg, typename Lhs, typename Rhs>
+    EXMATH_NO_LOOP_VECTORIZE constexpr void triangular_row_mult(Erg&                           erg,
+                                                                typename Erg::value_type const& alpha,
+                                                                Lhs const&                      lhs,
+                                                                Rhs const&                      rhs,
+                                                                typename Erg::value_type const& beta,
+                                                                index_t const&                  row,
+                                                                index_t const&                  col0)
+    {
+      using T = typename Erg::value_type;
+
+      index_t const first = Lhs::triangle == triangle_t::lower ? 0 : row;
+      index_t const last  = Lhs::triangle == triangle_t::lower ? row + 1 : Lhs::number_of_columns;
+      T             acc[width];
+      static_for<width, true>([&](index_t const& col) { acc[col] = lhs.element(row, first) * rhs(first, col0 + col); });
+      for (index_t idx = first + 1; idx < last; idx++)
+      {
+        T const fac = lhs.element(row, idx);
+        static_for<width, true>([&](index_t const& col) { acc[col] += fac * rhs(idx, col0 + col); });
+      }
+      static_for<width, true>([&](index_t const& col) { gemm_store(erg(row, col0 + col), alpha, acc[col], beta); });
+    }
+
+    // the whole row; full blocks unroll up to the unroll limit, the remaining columns run as a loop
+    template <typename Erg, typename Lhs, typename Rhs>
+    constexpr void triangular_row_mult(
+        Erg& erg, typename Erg::value_type const& alpha, Lhs const& lhs, Rhs const& rhs, typename Erg::value_type const& beta, index_t const& row)
+    {
+      using T = typename Erg::value_type;
+
+      constexpr index_t block = EXMATH_UNROLL_MAX_ELEMENTS;
+      constexpr index_t tail  = Erg::number_of_columns % block;
+      constexpr index_t col0  = Erg::number_of_columns - tail;
+
+      for (index_t col = 0; col < col0; col += block)
+        triangular_row_mult<block>(erg, alpha, lhs, rhs, beta, row, col);
+      if constexpr (tail != 0)
+      {
+        index_t const first = Lhs::triangle == triangle_t::lower ? 0 : row;
+        index_t const last  = Lhs::triangle == triangle_t::lower ? row + 1 : Lhs::number_of_columns;
+        T             acc[tail];
+        for (index_t col = 0; col < tail; col++)
+          acc[col] = lhs.element(row, first) * rhs(first, col0 + col);
+        for (index_t idx = first + 1; idx < last; idx++)
+        {
+          T const fac = lhs.element(row, idx);
+          for (index_t col = 0; col < tail; col++)
+            acc[col] += fac * rhs(idx, col0 + col);
+        }
+        for (index_t col = 0; col < tail; col++)
+          gemm_store(erg(row, col0 + col), alpha, acc[col], beta);
+      }
+    }
+
+    // erg = alpha * lhs * rhs + beta * erg where lhs and/or rhs is triangular; the sums skip the known zeros of the triangles.
+    // a triangular erg only gets its own triangle written
+    template <typename Erg, typename Lhs, typename Rhs>
+    constexpr void triangular_mult(Erg& erg, typename Erg::value_type const& alpha, Lhs const& lhs, Rhs const& rhs, typename Erg::value_type const& beta)
+    {
+      using T = typename Erg::value_type;
+
+      // small products are faster as fully unrolled dense loops than with the variable bounds of a triangle
+      if constexpr (!is_triangular_matrix<Erg> && Erg::number_of_elements < triangular_min_elements)
+      {
+        if constexpr (is_triangular_matrix<Lhs> && is_triangular_matrix<Rhs>)
+          gemm_reference(erg, alpha, packed_rhs_t<Lhs>{ lhs }, packed_rhs_t<Rhs>{ rhs }, beta);
+        else if constexpr (is_triangular_matrix<Lhs>)
+          gemm_reference(erg, alpha, packed_rhs_t<Lhs>{ lhs }, rhs, beta);
+        else
+          gemm_reference(erg, alpha, lhs, packed_rhs_t<Rhs>{ rhs }, beta);
+        return;
+      }
+
+      if constexpr (is_triangular_matrix<Lhs> && !is_triangular_matrix<Rhs> && !is_triangular_matrix<Erg>)
+      {
+        for (index_t row = 0; row < Erg::number_of_rows; row++)
+          triangular_row_mult(erg, alpha, lhs, rhs, beta, row);
+        return;
+      }
+
+      for_each_index<Erg>(
+          [&](index_t const& row, index_t const& col)
+          {
+            index_t first = 0;
+            index_t last  = Lhs::number_of_columns;
+            if constexpr (is_triangular_matrix<Erg>)
+            {
+              if (!Erg::contains(row, col))
+                return;
+            }
+            if constexpr (is_triangular_matrix<Lhs>)
+            {
+              if constexpr (Lhs::triangle == triangle_t::lower)
+                last = row + 1;
+              else
+                first = row;
+            }
+            if constexpr (is_triangular_matrix<Rhs>)
+            {
+              if constexpr (Rhs::triangle == triangle_t::lower)
+                first = first < col ? col : first;
+              else
+                last = last < col + 1 ? last : col + 1;
+            }
+
+            T tmp = 0;
+            for (index_t idx = first; idx < last; idx++)
+              tmp += stored(lhs, row, idx) * stored(rhs, idx, col);
+
+            if constexpr (is_triangular_matrix<Erg>)
+              gemm_store(erg.element(row, col), alpha, tmp, beta);
+            else
+              gemm_store(erg(row, col), alpha, tmp, beta);
+          });
+    }
+
+    // erg = alpha * lhs * rhs + beta * erg where lhs and/or rhs is banded; the sums only run over the band
+    template <typename Erg, typename Lhs, typename Rhs>
+    constexpr void banded_mult(Erg& erg, typename Erg::value_type const& alpha, Lhs const& lhs, Rhs const& rhs, typename Erg::value_type const& beta)
+    {
+      using T = typename Erg::value_type;
+
+      for_each_index<Erg>(
+          [&](index_t const& row, index_t const& col)
+          {
+            index_t first = 0;
+            index_t last  = Lhs::number_of_columns;
+            if constexpr (is_banded_matrix<Lhs>)
+            {
+              first = Lhs::first_column(row);
+              last  = Lhs::last_column(row);
+            }
+            if constexpr (is_banded_matrix<Rhs>)
+            {
+              first = first < Rhs::first_row(col) ? Rhs::first_row(col) : first;
+              last  = last < Rhs::last_row(col) ? last : Rhs::last_row(col);
+            }
+
+            T tmp = 0;
+            for (index_t idx = first; idx < last; idx++)
+              tmp += stored(lhs, row, idx) * stored(rhs, idx, col);
+            gemm_store(erg(row, col), alpha, tmp, beta);
+          });
+    }
+
+    // erg = alpha * lhs * rhs + beta * erg; erg must not share memory with lhs or rhs
+    template <writeable_static_matrix_concept Erg, typename Lhs, typename Rhs>
+    requires readable_like_matrix_concept<Lhs, typename Erg::value_type>&& readable_like_matrix_concept<Rhs, typename Erg::value_type> constexpr void
+    gemm(Erg& erg, typename Erg::value_type const& alpha, Lhs const& lhs, Rhs const& rhs, typename Erg::value_type const& beta)
+    {
+      if constexpr (is_diagonal_matrix<Lhs> || is_diagonal_matrix<Rhs>)
+      {
+        diagonal_mult(erg, alpha, lhs, rhs, beta);
+        return;
+      }
+      else if constexpr (is_triangular_matrix<Lhs> || is_triangular_matrix<Rhs>)
+      {
+        triangular_mult(erg, alpha, lhs, rhs, beta);
+        return;
+      }
+      else if constexpr (is_banded_matrix<Lhs> || is_banded_matrix<Rhs>)
+      {
+        banded_mult(erg, alpha, lhs, rhs, beta);
+        return;
+      }
+      else if constexpr (symmetric_unpack_concept<Lhs>)
+      {
+        // unpacking costs n^2 reads against the n^3 of the product and lets it use the kernels for matrices in memory
+        Internal::gemm(erg, alpha, packed_rhs_t<Lhs>{ lhs }, rhs, beta);
+        return;
+      }
+      else if constexpr (symmetric_unpack_concept<Rhs>)
+      {
+        Internal::gemm(erg, alpha, lhs, packed_rhs_t<Rhs>{ rhs }, beta);
+        return;
+      }
+      else if constexpr (is_symmetric_matrix<Lhs> || is_symmetric_matrix<Rhs>)
+      {
+        gemm_reference(erg, alpha, lhs, rhs, beta);
+        return;
+      }
+
+      // A^T * B^T into a column major erg is B * A into the row major transpose of erg, which reads A and B in their own order
+      if constexpr (is_transpose_view<Lhs> && is_transpose_view<Rhs> && strided_static_matrix_concept<Erg> &&
+                    Erg::storage_order == storage_order_t::column_major)
+      {
+        transposed_target_t<Erg> target{ erg };
+        Internal::gemm(target, alpha, rhs.base(), lhs.base(), beta);
+        return;
+      }
+
+      if constexpr (runtime_kernel_concept<Erg, Lhs, Rhs>)
+      {
+        if (!std::is_constant_evaluated())
+        {
+          runtime_gemm(Erg::number_of_rows,
+                       Erg::number_of_columns,
+                       Lhs::number_of_columns,
+                       alpha,
+                       { lhs.data(), row_stride_of(lhs), column_stride_of(lhs) },
+                       { rhs.data(), row_stride_of(rhs), column_stride_of(rhs) },
+                       beta,
+                       { erg.data(), row_stride_of(erg), column_stride_of(erg) });
+          return;
+        }
+      }
+
+      if constexpr (gemm_packed_concept<Rhs>)
+        Internal::gemm(erg, alpha, lhs, packed_rhs_t<Rhs>{ rhs }, beta);
+      else if constexpr (strided_static_matrix_concept<Erg> && strided_static_matrix_concept<Lhs> && strided_static_matrix_concept<Rhs> &&
+                         gemm_tiled_concept<Lhs>)
+        gemm_blocked(erg, alpha, lhs, rhs, beta);
+      else
+        gemm_reference(erg, alpha, lhs, rhs, beta);
+    }
+
+    template <writeable_static_matrix_concept Erg, typename Lhs, typename Rhs>
+    requires readable_like_matrix_concept<Lhs, typename Erg::value_type>&& readable_like_matrix_concept<Rhs, typename Erg::value_type> constexpr void
+                                                                           mult(Erg& erg, Lhs const& lhs, Rhs const& rhs)
+    {
+      using T = typename Erg::value_type;
+      Internal::gemm(erg, T{ 1 }, lhs, rhs, T{ 0 });
+    }
+
+    // from this many elements of erg on, about 20x20, symmetric_mult hands the product to the runtime gemm kernels in blocks of rows
+    constexpr index_t symmetric_gemm_min_elements = 400;
+    constexpr index_t symmetric_gemm_block_rows   = 16;
+
+    // erg = lhs * rhs for a product known to be symmetric: only the upper triangle is computed and mirrored, which halves the
+    // work and makes erg exactly symmetric
+    template <writeable_static_matrix_concept Erg, typename Lhs, typename Rhs>
+    requires readable_like_matrix_concept<Lhs, typename Erg::value_type>&& readable_like_matrix_concept<Rhs, typename Erg::value_type> constexpr void
+    symmetric_mult(Erg& erg, Lhs const& lhs, Rhs const& rhs)
+    {
+      using T                 = typename Erg::value_type;
+      constexpr bool unrolled = unrolled_static_matrix_concept<Erg> && unrolled_static_matrix_concept<Lhs>;
+
+      // the runtime gemm kernels are faster than the dot products; each block of rows is multiplied from its diagonal on, so only
+      // the lower halves of the diagonal blocks are computed beyond the upper triangle, and they are overwritten by the mirror
+      if constexpr (runtime_kernel_concept<Erg, Lhs, Rhs> && Erg::number_of_elements >= symmetric_gemm_min_elements)
+      {
+        if (!std::is_constant_evaluated())
+        {
+          constexpr index_t N = Erg::number_of_rows;
+          for (index_t row = 0; row < N; row += symmetric_gemm_block_rows)
+          {
+            index_t const rows = N - row < symmetric_gemm_block_rows ? N - row : symmetric_gemm_block_rows;
+            runtime_gemm(rows,
+                         N - row,
+                         Lhs::number_of_columns,
+                         T{ 1 },
+                         { lhs.data() + row * row_stride_of(lhs), row_stride_of(lhs), column_stride_of(lhs) },
+                         { rhs.data() + row * column_stride_of(rhs), row_stride_of(rhs), column_stride_of(rhs) },
+                         T{ 0 },
+                         { erg.data() + row * (row_stride_of(erg) + column_stride_of(erg)), row_stride_of(erg), column_stride_of(erg) });
+          }
+          for (index_t row = 1; row < Erg::number_of_rows; row++)
+            for (index_t col = 0; col < row; col++)
+              erg(row, col) = erg(col, row);
+          return;
+        }
+      }
+
+      static_for<Erg::number_of_rows, unrolled>(
+          [&](index_t const& row) EXMATH_ALWAYS_INLINE
+          {
+            static_for<Erg::number_of_columns, unrolled>(
+                [&](index_t const& col) EXMATH_ALWAYS_INLINE
+                {
+                  if (col < row)
+                    return;
+                  T tmp = 0;
+                  static_for<Lhs::number_of_columns, unrolled>([&](index_t const& idx) EXMATH_ALWAYS_INLINE { tmp += lhs(row, idx) * rhs(idx, col); });
+                  erg(row, col) = tmp;
+                  erg(col, row) = tmp;
+                });
+          });
+    }
+
+    // erg = alpha * val * transpose(val) + beta * erg for a symmetric erg; each unique element is one dot product of two rows of val
+    template <typename Erg, typename Val>
+    constexpr void symmetric_rank_k(Erg& erg, typename Erg::value_type const& alpha, Val const& val, typename Erg::value_type const& beta)
+    {
+      using T                 = typename Erg::value_type;
+      constexpr bool unrolled = unrolled_static_matrix_concept<Erg> && unrolled_static_matrix_concept<Val>;
+
+      static_for<Erg::number_of_rows, unrolled>(
+          [&](index_t const& row) EXMATH_ALWAYS_INLINE
+          {
+            static_for<Erg::number_of_columns, unrolled>(
+                [&](index_t const& col) EXMATH_ALWAYS_INLINE
+                {
+                  if (row < col)
+                    return;
+                  T tmp = 0;
+                  static_for<Val::number_of_columns, unrolled>([&](index_t const& idx) EXMATH_ALWAYS_INLINE { tmp += val(row, idx) * val(col, idx); });
+                  gemm_store(erg.element(row, col), alpha, tmp, beta);
+                });
+          });
+    }
+
+    template <writeable_static_matrix_concept Erg, typename Val>
+    requires readable_like_matrix_concept<Val, typename Erg::value_type> constexpr void scale(Erg& erg, Val const& val, typename Val::value_type const& scale)
+    {
+      if constexpr (same_contiguous_layout<Erg, Val>)
+      {
+        auto*       dst = erg.data();
+        auto const* src = val.data();
+        for_each_element<Erg>([&](index_t const& idx) { dst[idx] = src[idx] * scale; });
+      }
+      else
+      {
+        for_each_index<Erg>([&](index_t const& row, index_t const& col) { erg(row, col) = val(row, col) * scale; });
+      }
+    }
+
+    // gauss-jordan elimination with partial pivoting of val * x = erg in place of erg
+    template <bool unrolled, typename Lhs, typename Rhs> EXMATH_ALWAYS_INLINE constexpr void gauss_jordan(Lhs& val, Rhs& erg)
+    {
+      using value_type    = typename Lhs::value_type;
+      constexpr index_t N = Lhs::number_of_rows;
+
+      auto swap_rows = [](auto& mat, index_t const& r1, index_t const& r2) EXMATH_ALWAYS_INLINE
+      {
+        static_for<std::remove_cvref_t<decltype(mat)>::number_of_columns, unrolled>(
+            [&](index_t const& col) EXMATH_ALWAYS_INLINE { std::swap(mat(r1, col), mat(r2, col)); });
+      };
+
+      auto div_row = [](auto& mat, value_type const& val, index_t const& row) EXMATH_ALWAYS_INLINE
+      { static_for<std::remove_cvref_t<decltype(mat)>::number_of_columns, unrolled>([&](index_t const& col) EXMATH_ALWAYS_INLINE { mat(row, col) /= val; }); };
+
+      auto sub_scl_rows = [](auto& mat, value_type const& val, index_t const& r1, index_t const& r2) EXMATH_ALWAYS_INLINE
+      {
+        static_for<std::remove_cvref_t<decltype(mat)>::number_of_columns, unrolled>(
+            [&](index_t const& col) EXMATH_ALWAYS_INLINE { mat(r1, col) -= mat(r2, col) * val; });
+      };
+
+      static_for<N, unrolled>(
+          [&](index_t const& row) EXMATH_ALWAYS_INLINE
+          {
+            {
+              index_t    sel_idx = row;
+              value_type fac     = val(row, row);
+              static_for<N, unrolled>(
+                  [&](index_t const& idx) EXMATH_ALWAYS_INLINE
+                  {
+                    if (idx > row && Internal::abs(fac) < Internal::abs(val(idx, row)))
+                    {
+                      sel_idx = idx;
+                      fac     = val(idx, row);
+                    }
+                  });
+
+              if (sel_idx != row)
+              {
+                swap_rows(val, sel_idx, row);
+                swap_rows(erg, sel_idx, row);
+              }
+
+              if (fac != 1.0)
+              {
+                div_row(val, fac, row);
+                div_row(erg, fac, row);
+              }
+            }
+
+            static_for<N, unrolled>(
+                [&](index_t const& idx) EXMATH_ALWAYS_INLINE
+                {
+                  if (idx == row)
+                    return;
+                  value_type const fac = val(idx, row);
+                  sub_scl_rows(val, fac, idx, row);
+                  sub_scl_rows(erg, fac, idx, row);
+                });
+          });
+    }
+
+    // the sizes that are not unrolled: the runtime kernel or the elimination as loops, out of line
+    template <typename Lhs, typename Rhs> constexpr void solve_looped(Lhs& val, Rhs& erg)
+    {
+      constexpr index_t N = Lhs::number_of_rows;
+
+      // the runtime kernel walks rows with unit stride
+      if constexpr (runtime_kernel_concept<Lhs, Rhs>)
+      {
+        if constexpr (Lhs::storage_order == storage_order_t::row_major &&
+                      (Rhs::storage_order == storage_order_t::row_major || Rhs::number_of_columns == 1))
+        {
+          if (!std::is_constant_evaluated())
+          {
+            runtime_lu_solve(N, Rhs::number_of_columns, { val.data(), row_stride_of(val), 1 }, { erg.data(), row_stride_of(erg), 1 });
+            return;
+          }
+        }
+      }
+
+      gauss_jordan<false>(val, erg);
+    }
+
+    // solves val * x = erg in place of erg; val is used as scratch and holds no meaningful values afterwards. unrolled sizes
+    // are always inlined into the caller as straight-line code
+    template <writeable_static_matrix_concept Lhs, writeable_static_matrix_concept Rhs>
+    requires(Lhs::number_of_rows == Lhs::number_of_columns && Lhs::number_of_rows == Rhs::number_of_rows) EXMATH_ALWAYS_INLINE constexpr void solve(Lhs& val,
+                                                                                                                                        Rhs& erg)
+    {
+      if constexpr (unrolled_static_matrix_concept<Lhs> && unrolled_static_matrix_concept<Rhs>)
+        gauss_jordan<true>(val, erg);
+      else
+        solve_looped(val, erg);
+    }
+  }    // namespace Internal
+}    // namespace ExMath
+
+namespace ExMath
+{
+  namespace Internal
+  {
+    template <index_t elements, typename T>
+    using default_storage_t = std::conditional_t<(elements * sizeof(T) <= EXMATH_INLINE_STORAGE_MAX_BYTES), inline_storage_t, heap_storage_t>;
+
+    // owned buffers are aligned to the vector width whenever that adds no padding behind the elements;
+    // external memory keeps its natural alignment unless a stronger one is asked for explicitly
+    template <typename Storage, index_t elements, typename T> constexpr std::size_t default_alignment() noexcept
+    {
+      if constexpr (!std::is_same_v<Storage, external_storage_t> && EXMATH_SIMD_ALIGNMENT > alignof(T) && (elements * sizeof(T)) % EXMATH_SIMD_ALIGNMENT == 0)
+        return EXMATH_SIMD_ALIGNMENT;
+      else
+        return alignof(T);
+    }
+
+    // extent rounded up so that every row (row major) or column (column major) starts on an alignment boundary
+    template <index_t extent, typename T, std::size_t alignment> constexpr index_t padded_extent() noexcept
+    {
+      constexpr index_t step = alignment % sizeof(T) == 0 && alignment > sizeof(T) ? static_cast<index_t>(alignment / sizeof(T)) : 1;
+      return (extent + step - 1) / step * step;
+    }
+
+    // distance between the starts of two rows (row major) or columns (column major), padded up to the alignment if requested
+    template <storage_order_t order, index_t rows, index_t columns, typename T, std::size_t alignment, bool padded> constexpr index_t leading_extent() noexcept
+    {
+      constexpr index_t extent = order == storage_order_t::row_major ? columns : rows;
+      if constexpr (padded)
+        return padded_extent<extent, T, alignment>();
+      else
+        return extent;
+    }
+
+    template <typename Storage, typename T, index_t elements, std::size_t alignment> class storage_buffer_t;
+
+    template <typename T, index_t elements, std::size_t alignment> class storage_buffer_t<inline_storage_t, T, elements, alignment>
+    {
+    public:
+      constexpr storage_buffer_t() noexcept = default;
+
+      template <typename... Us>
+      constexpr storage_buffer_t(std::in_place_t, Us&&... args) noexcept
+          : m_data{ std::forward<Us>(args)... }
+      {
+      }
+
+      constexpr void acquire() noexcept {}
+
+      constexpr auto data() const noexcept -> T const* { return this->m_data; }
+      constexpr auto data() noexcept -> T* { return this->m_data; }
+
+    private:
+      alignas(alignment) T m_data[elements]{};
+    };
+
+    // a moved-from buffer holds no memory until it is assigned to again
+    template <typename T, index_t elements, std::size_t alignment> class storage_buffer_t<heap_storage_t, T, elements, alignment>
+    {
+    public:
+      constexpr storage_buffer_t()
+          : m_data{ allocate() }
+      {
+      }
+
+      template <typename... Us>
+      constexpr storage_buffer_t(std::in_place_t, Us&&... args)
+          : m_data{ allocate() }
+      {
+        index_t idx = 0;
+        ((this->m_data[idx++] = std::forward<Us>(args)), ...);
+      }
+
+      constexpr storage_buffer_t(storage_buffer_t const& rhs)
+          : m_data{ allocate() }
+      {
+        this->copy_from(rhs);
+      }
+
+      constexpr storage_buffer_t(storage_buffer_t&& rhs) noexcept
+          : m_data{ std::exchange(rhs.m_data, nullptr) }
+      {
+      }
+
+      constexpr auto operator=(storage_buffer_t const& rhs) -> storage_buffer_t&
+      {
+        this->acquire();
+        if (this != &rhs)
+          this->copy_from(rhs);
+        return *this;
+      }
+
+      constexpr auto operator=(storage_buffer_t&& rhs) noexcept -> storage_buffer_t&
+      {
+        std::swap(this->m_data, rhs.m_data);
+        return *this;
+      }
+
+      constexpr ~storage_buffer_t() { deallocate(this->m_data); }
+
+      constexpr void acquire()
+      {
+        if (this->m_data == nullptr)
+          this->m_data = allocate();
+      }
+
+      constexpr auto data() const noexcept -> T const* { return std::assume_aligned<alignment>(this->m_data); }
+      constexpr auto data() noexcept -> T* { return std::assume_aligned<alignment>(this->m_data); }
+
+    private:
+      // constant evaluation cannot call the aligned operator new, buffers allocated there never outlive it
+      static constexpr T* allocate()
+      {
+        if (std::is_constant_evaluated())
+          return new T[elements]{};
+
+        T* ptr = static_cast<T*>(::operator new(sizeof(T) * elements, std::align_val_t{ alignment }));
+        std::uninitialized_value_construct_n(ptr, elements);
+        return ptr;
+      }
+
+      static constexpr void deallocate(T* ptr) noexcept
+      {
+        if (std::is_constant_evaluated())
+        {
+          delete[] ptr;
+          return;
+        }
+
+        if (ptr == nullptr)
+          return;
+        std::destroy_n(ptr, elements);
+        ::operator delete(ptr, std::align_val_t{ alignment });
+      }
+
+      constexpr void copy_from(storage_buffer_t const& rhs) noexcept
+      {
+        for (index_t idx = 0; idx < elements; idx++)
+          this->m_data[idx] = rhs.m_data[idx];
+      }
+
+      T* m_data;
+    };
+
+    template <typename T, index_t elements, std::size_t alignment> class storage_buffer_t<external_storage_t, T, elements, alignment>
+    {
+    public:
+      constexpr storage_buffer_t(T* data) noexcept
+          : m_data{ data }
+      {
+      }
+
+      constexpr storage_buffer_t(storage_buffer_t const&) noexcept = default;
+
+      constexpr auto operator=(storage_buffer_t const& rhs) noexcept -> storage_buffer_t&
+      {
+        for (index_t idx = 0; idx < elements && this->m_data != rhs.m_data; idx++)
+          this->m_data[idx] = rhs.m_data[idx];
+        return *this;
+      }
+
+      constexpr void acquire() noexcept {}
+
+      constexpr auto data() const noexcept -> T const* { return std::assume_aligned<alignment>(this->m_data); }
+      constexpr auto data() noexcept -> T* { return std::assume_aligned<alignment>(this->m_data); }
+
+    private:
+      T* m_data;
+    };
+  }    // namespace Internal
+
+  // elements given to the value constructor are in storage order, data() exposes them with leading_dimension between rows (row major)
+  // or columns (column major).
+  // storage selects where the elements live, by default inline up to EXMATH_INLINE_STORAGE_MAX_BYTES and on the heap above;
+  // heap allocation failure terminates since the interface is noexcept throughout.
+  // data() is aligned to alignment; padded additionally rounds the leading dimension up to a multiple of the alignment so every
+  // row (column) starts aligned
+  template <index_t rows,
+            index_t columns,
+            typename T,
+            storage_order_t order = storage_order_t::row_major,
+            typename storage      = Internal::default_storage_t<rows * columns, std::remove_cvref_t<T>>,
+            std::size_t alignment = Internal::default_alignment<storage, rows * columns, std::remove_cvref_t<T>>(),
+            bool        padded    = false>
+  class static_matrix_t
+  {
+  public:
+    using value_type                                    = std::remove_cvref_t<T>;
+    using storage_type                                  = storage;
+    static constexpr index_t         number_of_rows     = rows;
+    static constexpr index_t         number_of_columns  = columns;
+    static constexpr index_t         number_of_elements = rows * columns;
+    static constexpr storage_order_t storage_order      = order;
+    static constexpr std::size_t     data_alignment     = alignment;
+    static constexpr index_t         leading_dimension  = Internal::leading_extent<order, rows, columns, value_type, alignment, padded>();
+    // size of the buffer behind data(), including padding
+    static constexpr index_t number_of_stored_elements = (order == storage_order_t::row_major ? rows : columns) * leading_dimension;
+
+    static_assert(alignment >= alignof(value_type) && (alignment & (alignment - 1)) == 0);
+
+    constexpr static_matrix_t() noexcept requires(!std::is_same_v<storage, external_storage_t>) = default;
+
+    constexpr static_matrix_t(value_type (&data)[number_of_stored_elements]) noexcept
+        requires(std::is_same_v<storage, external_storage_t> && alignment == alignof(value_type))
+        : m_storage{ data }
+    {
+    }
+
+    // external memory with a stronger alignment than its value_type is only handed out after checking the address once here
+    static auto wrap(value_type* data) noexcept -> std::optional<static_matrix_t> requires std::is_same_v<storage, external_storage_t>
+    {
+      if (data == nullptr || reinterpret_cast<std::uintptr_t>(data) % alignment != 0)
+        return std::nullopt;
+      return static_matrix_t{ std::in_place, data };
+    }
+
+    template <typename Rhs>
+    requires(is_assignable<static_matrix_t, Rhs> && !std::is_same_v<storage, external_storage_t>) constexpr static_matrix_t(Rhs const& rhs) noexcept
+    {
+      Internal::assign(*this, rhs);
+    }
+
+    template <typename... Us>
+    requires(std::is_convertible_v<std::common_type_t<Us...>, value_type> && !std::is_same_v<storage, external_storage_t> && !padded) constexpr static_matrix_t(
+        Us&&... args) noexcept
+        : m_storage{ std::in_place, std::forward<Us>(args)... }
+    {
+      static_assert(sizeof...(Us) == number_of_elements);
+    };
+
+    template <typename... Us>
+    requires(std::is_convertible_v<std::common_type_t<Us...>, value_type> && !std::is_same_v<storage, external_storage_t> && padded) constexpr static_matrix_t(
+        Us&&... args) noexcept
+    {
+      static_assert(sizeof...(Us) == number_of_elements);
+
+      constexpr index_t extent = order == storage_order_t::row_major ? columns : rows;
+      value_type const  values[]{ static_cast<value_type>(std::forward<Us>(args))... };
+      for (index_t idx = 0; idx < number_of_elements; idx++)
+        this->data()[idx / extent * leading_dimension + idx % extent] = values[idx];
+    }
+
+    constexpr auto operator()(index_t const& row, index_t const& col) const noexcept -> value_type const&
+    {
+      return this->data()[Internal::calc_index_strided<storage_order, leading_dimension>(row, col)];
+    }
+
+    constexpr auto operator()(index_t const& row, index_t const& col) noexcept -> value_type&
+    {
+      return this->data()[Internal::calc_index_strided<storage_order, leading_dimension>(row, col)];
+    }
+
+    template <typename Rhs> requires is_assignable<static_matrix_t, Rhs> constexpr auto operator=(Rhs const& rhs) noexcept
+    {
+      this->m_storage.acquire();
+      if (Internal::is_aliased(*this, rhs))
+        Internal::assign(*this, static_matrix_t<rows, columns, value_type, order>{ rhs });
+      else
+        Internal::assign(*this, rhs);
+      return *this;
+    };
+
+    constexpr auto data() const noexcept -> value_type const* { return this->m_storage.data(); }
+    constexpr auto data() noexcept -> value_type* { return this->m_storage.data(); }
+
+  private:
+    constexpr static_matrix_t(std::in_place_t, value_type* data) noexcept requires std::is_same_v<storage, external_storage_t>
+        : m_storage{ data }
+    {
+    }
+
+    Internal::storage_buffer_t<storage, value_type, number_of_stored_elements, alignment> m_storage;
+  };
+
+  template <index_t rows, index_t columns, typename T, storage_order_t order> class static_matrix_t<rows, columns, const T, order>
+  {
+  public:
+    using value_type                                    = std::remove_cvref_t<T>;
+    static constexpr index_t         number_of_rows     = rows;
+    static constexpr index_t         number_of_columns  = columns;
+    static constexpr index_t         number_of_elements = rows * columns;
+    static constexpr storage_order_t storage_order      = order;
+
+    constexpr static_matrix_t(value_type const (&data)[number_of_elements]) noexcept
+        : m_data{ data }
+    {
+    }
+
+    constexpr auto operator()(index_t const& row, index_t const& col) const noexcept -> value_type const&
+    {
+      return this->m_data[Internal::calc_index<storage_order, number_of_rows, number_of_columns>(row, col)];
+    }
+
+    constexpr auto data() const noexcept -> value_type const* { return this->m_data; }
+
+  private:
+    value_type const (&m_data)[number_of_elements]{};
+  };
+
+  template <index_t rows, index_t columns, typename T, storage_order_t order = storage_order_t::row_major>
+  using static_matrix_external_memory_t = static_matrix_t<rows, columns, T, order, external_storage_t>;
+
+  // created through wrap(), which rejects addresses that miss the alignment
+  template <index_t         rows,
+            index_t         columns,
+            typename T,
+            storage_order_t order     = storage_order_t::row_major,
+            std::size_t     alignment = EXMATH_SIMD_ALIGNMENT,
+            bool            padded    = false>
+  using static_matrix_aligned_external_memory_t = static_matrix_t<rows, columns, T, order, external_storage_t, alignment, padded>;
+
+  // rows x columns matrix in caller managed memory whose consecutive rows (row major) or columns (column major) start stride()
+  // elements apart, e.g. a tile of a larger image or a padded buffer from a pool; a view of const T is read only.
+  // created through wrap(), which rejects null pointers and strides shorter than a row (column)
+  template <index_t rows, index_t columns, typename T, storage_order_t order = storage_order_t::row_major> class strided_view_t
+  {
+  public:
+    using value_type                                    = std::remove_cv_t<T>;
+    static constexpr index_t         number_of_rows     = rows;
+    static constexpr index_t         number_of_columns  = columns;
+    static constexpr index_t         number_of_elements = rows * columns;
+    static constexpr storage_order_t storage_order      = order;
+
+    static constexpr auto wrap(T* data, index_t stride) noexcept -> std::optional<strided_view_t>
+    {
+      if (data == nullptr || stride < (order == storage_order_t::row_major ? columns : rows))
+        return std::nullopt;
+      return strided_view_t{ data, stride };
+    }
+
+    constexpr strided_view_t(strided_view_t const&) noexcept = default;
+
+    // assignment writes through to the viewed elements, also from another view of the same type
+    constexpr auto operator=(strided_view_t const& rhs) noexcept -> strided_view_t& { return this->operator= <strided_view_t>(rhs); }
+
+    template <typename Rhs> requires is_assignable<strided_view_t, Rhs> constexpr auto operator=(Rhs const& rhs) noexcept -> strided_view_t&
+    {
+      if (Internal::is_aliased(*this, rhs))
+        Internal::assign(*this, static_matrix_t<rows, columns, value_type, order>{ rhs });
+      else
+        Internal::assign(*this, rhs);
+      return *this;
+    }
+
+    constexpr auto operator()(index_t const& row, index_t const& col) const noexcept -> value_type const& { return this->m_data[this->index(row, col)]; }
+
+    constexpr auto operator()(index_t const& row, index_t const& col) noexcept -> value_type& requires(!std::is_const_v<T>)
+    {
+      return this->m_data[this->index(row, col)];
+    }
+
+    constexpr auto data() const noexcept -> value_type const* { return this->m_data; }
+    constexpr auto data() noexcept -> T* { return this->m_data; }
+    constexpr auto stride() const noexcept -> index_t { return this->m_stride; }
+
+  private:
+    constexpr strided_view_t(T* data, index_t stride) noexcept
+        : m_data{ data }
+        , m_stride{ stride }
+    {
+    }
+
+    constexpr auto index(index_t const& row, index_t const& col) const noexcept -> std::size_t
+    {
+      if constexpr (order == storage_order_t::column_major)
+        return static_cast<std::size_t>(col) * this->m_stride + row;
+      else
+        return static_cast<std::size_t>(row) * this->m_stride + col;
+    }
+
+    T*      m_data;
+    index_t m_stride;
+  };
+
+  template <index_t rows, index_t columns, typename T> class identity_matrix_t
+  {
+  public:
+    using value_type                            = std::remove_cvref_t<T>;
+    static constexpr index_t number_of_rows     = rows;
+    static constexpr index_t number_of_columns  = columns;
+    static constexpr index_t number_of_elements = rows * columns;
+
+    constexpr auto operator()(index_t const& row, index_t const& col) const noexcept -> value_type
+    {
+      if (row == col)
+        return static_cast<value_type>(1);
+      return static_cast<value_type>(0);
+    }
+  };
+
+  template <index_t rows, index_t columns, typename T> class zero_matrix_t
+  {
+  public:
+    using value_type                            = std::remove_cvref_t<T>;
+    static constexpr index_t number_of_rows     = rows;
+    static constexpr index_t number_of_columns  = columns;
+    static constexpr index_t number_of_elements = rows * columns;
+
+    constexpr auto operator()(index_t const&, index_t const&) const noexcept -> value_type { return static_cast<value_type>(0); }
+  };
+
+  // square matrix that stores only its diagonal; products with it scale rows or columns, sums only touch the diagonal
+  template <index_t N, typename T> class diagonal_matrix_t
+  {
+  public:
+    using value_type                            = std::remove_cvref_t<T>;
+    static constexpr index_t number_of_rows     = N;
+    static constexpr index_t number_of_columns  = N;
+    static constexpr index_t number_of_elements = N * N;
+
+    constexpr diagonal_matrix_t() noexcept = default;
+
+    template <typename... Us>
+    requires(sizeof...(Us) == N && (std::is_convertible_v<Us, value_type> && ...)) constexpr diagonal_matrix_t(Us&&... args) noexcept
+        : m_diagonal{ static_cast<value_type>(std::forward<Us>(args))... }
+    {
+    }
+
+    // the diagonal taken from a row or column vector
+    template <readable_static_matrix_concept Vec>
+    requires((Vec::number_of_rows == 1 || Vec::number_of_columns == 1) && Vec::number_of_elements == N && !is_diagonal_matrix<Vec>) constexpr explicit
+    diagonal_matrix_t(Vec const& vec) noexcept
+    {
+      for (index_t idx = 0; idx < N; idx++)
+        this->m_diagonal[idx] = Vec::number_of_columns == 1 ? vec(idx, 0) : vec(0, idx);
+    }
+
+    constexpr auto operator()(index_t const& row, index_t const& col) const noexcept -> value_type
+    {
+      if (row == col)
+        return this->m_diagonal[row];
+      return static_cast<value_type>(0);
+    }
+
+    constexpr auto diagonal(index_t const& idx) const noexcept -> value_type const& { return this->m_diagonal[idx]; }
+    constexpr auto diagonal(index_t const& idx) noexcept -> value_type& { return this->m_diagonal[idx]; }
+
+  private:
+    value_type m_diagonal[N]{};
+  };
+
+  // square matrix that is zero outside its lower or upper triangle; solves with it are substitutions, products skip the zeros
+  template <index_t N, typename T, triangle_t tri, triangular_storage_t storage = triangular_storage_t::packed> class triangular_matrix_t
+  {
+  public:
+    using value_type                                                = std::remove_cvref_t<T>;
+    static constexpr index_t              number_of_rows            = N;
+    static constexpr index_t              number_of_columns         = N;
+    static constexpr index_t              number_of_elements        = N * N;
+    static constexpr triangle_t           triangle                  = tri;
+    static constexpr triangular_storage_t triangle_storage          = storage;
+    static constexpr index_t              number_of_stored_elements = storage == triangular_storage_t::packed ? N * (N + 1) / 2 : N * N;
+
+    constexpr triangular_matrix_t() noexcept = default;
+
+    // only the triangle of mat is read
+    template <readable_static_matrix_concept Mat>
+    requires(Mat::number_of_rows == N && Mat::number_of_columns == N) constexpr explicit triangular_matrix_t(Mat const& mat) noexcept
+    {
+      for (index_t row = 0; row < N; row++)
+        for (index_t col = tri == triangle_t::lower ? 0 : row; col < (tri == triangle_t::lower ? row + 1 : N); col++)
+          this->element(row, col) = mat(row, col);
+    }
+
+    static constexpr bool contains(index_t const& row, index_t const& col) noexcept { return tri == triangle_t::lower ? col <= row : row <= col; }
+
+    constexpr auto operator()(index_t const& row, index_t const& col) const noexcept -> value_type
+    {
+      if (contains(row, col))
+        return this->m_data[offset(row, col)];
+      return static_cast<value_type>(0);
+    }
+
+    // element (row, col) inside the triangle
+    constexpr auto element(index_t const& row, index_t const& col) const noexcept -> value_type const& { return this->m_data[offset(row, col)]; }
+    constexpr auto element(index_t const& row, index_t const& col) noexcept -> value_type& { return this->m_data[offset(row, col)]; }
+
+  private:
+    // rows of the triangle one after another
+    static constexpr index_t offset(index_t const& row, index_t const& col) noexcept
+    {
+      if constexpr (storage == triangular_storage_t::full)
+        return row * N + col;
+      else if constexpr (tri == triangle_t::lower)
+        return row * (row + 1) / 2 + col;
+      else
+        return row * (2 * N - row + 1) / 2 + col - row;
+    }
+
+    value_type m_data[number_of_stored_elements]{};
+  };
+
+  template <index_t N, typename T, triangular_storage_t storage = triangular_storage_t::packed>
+  using lower_triangular_t = triangular_matrix_t<N, T, triangle_t::lower, storage>;
+  template <index_t N, typename T, triangular_storage_t storage = triangular_storage_t::packed>
+  using upper_triangular_t = triangular_matrix_t<N, T, triangle_t::upper, storage>;
+
+  // square matrix equal to its transpose that stores each of its n * (n + 1) / 2 unique elements once; sums and scaling touch
+  // every unique element once and stay symmetric
+  template <index_t N, typename T> class symmetric_matrix_t
+  {
+  public:
+    using value_type                                   = std::remove_cvref_t<T>;
+    static constexpr index_t number_of_rows            = N;
+    static constexpr index_t number_of_columns         = N;
+    static constexpr index_t number_of_elements        = N * N;
+    static constexpr index_t number_of_stored_elements = N * (N + 1) / 2;
+
+    constexpr symmetric_matrix_t() noexcept = default;
+
+    // only the lower triangle of mat is read
+    template <readable_static_matrix_concept Mat>
+    requires(Mat::number_of_rows == N && Mat::number_of_columns == N) constexpr explicit symmetric_matrix_t(Mat const& mat) noexcept
+    {
+      for (index_t row = 0; row < N; row++)
+        for (index_t col = 0; col <= row; col++)
+          this->element(row, col) = mat(row, col);
+    }
+
+    constexpr auto operator()(index_t const& row, index_t const& col) const noexcept -> value_type const& { return this->m_data[offset(row, col)]; }
+
+    // element (row, col), which is element (col, row) as well
+    constexpr auto element(index_t const& row, index_t const& col) const noexcept -> value_type const& { return this->m_data[offset(row, col)]; }
+    constexpr auto element(index_t const& row, index_t const& col) noexcept -> value_type& { return this->m_data[offset(row, col)]; }
+
+    // the unique elements, the rows of the lower triangle one after another
+    constexpr auto data() const noexcept -> value_type const* { return this->m_data; }
+    constexpr auto data() noexcept -> value_type* { return this->m_data; }
+
+    // the buffer is held inline, so only erg itself can write to it
+    template <typename Erg> constexpr bool references(Erg const& erg) const noexcept
     {
-      for (index_t col = 0; col < Erg::number_of_columns; col++)
-        for (index_t row = 0; row < Erg::number_of_rows; row++)
-          erg(row, col) += rhs(row, col);
+      return static_cast<void const*>(&erg) == static_cast<void const*>(this);
     }
 
-    template <writeable_static_matrix_concept Erg, typename Val>
-    requires readable_like_matrix_concept<Val, typename Erg::value_type> constexpr void sub_assign(Erg& erg, Val const& rhs)
+    constexpr auto operator+=(symmetric_matrix_t const& rhs) noexcept -> symmetric_matrix_t&
     {
-      for (index_t col = 0; col < Erg::number_of_columns; col++)
-        for (index_t row = 0; row < Erg::number_of_rows; row++)
-          erg(row, col) -= rhs(row, col);
+      Internal::for_each_stored<symmetric_matrix_t>([&](index_t const& idx) { this->m_data[idx] += rhs.m_data[idx]; });
+      return *this;
     }
 
-    template <writeable_static_matrix_concept Erg, typename Val> constexpr void mult_assign(Erg& erg, Val const& val)
+    constexpr auto operator-=(symmetric_matrix_t const& rhs) noexcept -> symmetric_matrix_t&
     {
-      for (index_t col = 0; col < Erg::number_of_columns; col++)
-        for (index_t row = 0; row < Erg::number_of_rows; row++)
-          erg(row, col) *= val;
+      Internal::for_each_stored<symmetric_matrix_t>([&](index_t const& idx) { this->m_data[idx] -= rhs.m_data[idx]; });
+      return *this;
     }
 
-    template <writeable_static_matrix_concept Erg, typename Val> constexpr void div_assign(Erg& erg, Val const& rhs)
+    constexpr auto operator*=(value_type const& rhs) noexcept -> symmetric_matrix_t&
     {
-      for (index_t col = 0; col < Erg::number_of_columns; col++)
-        for (index_t row = 0; row < Erg::number_of_rows; row++)
-          erg(row, col) /= rhs;
+      Internal::for_each_stored<symmetric_matrix_t>([&](index_t const& idx) { this->m_data[idx] *= rhs; });
+      return *this;
     }
 
-    template <writeable_static_matrix_concept Erg, typename Lhs, typename Rhs>
-    requires readable_like_matrix_concept<Lhs, typename Erg::value_type>&& readable_like_matrix_concept<Rhs, typename Erg::value_type> constexpr void
-                                                                           add(Erg& erg, Lhs const& lhs, Rhs const& rhs)
+    constexpr auto operator/=(value_type const& rhs) noexcept -> symmetric_matrix_t&
     {
-      for (index_t col = 0; col < Erg::number_of_columns; col++)
-        for (index_t row = 0; row < Erg::number_of_rows; row++)
-          erg(row, col) = lhs(row, col) + rhs(row, col);
+      Internal::for_each_stored<symmetric_matrix_t>([&](index_t const& idx) { this->m_data[idx] /= rhs; });
+      return *this;
     }
 
-    template <writeable_static_matrix_concept Erg, typename Lhs, typename Rhs>
-    requires readable_like_matrix_concept<Lhs, typename Erg::value_type>&& readable_like_matrix_concept<Rhs, typename Erg::value_type> constexpr void
-                                                                           sub(Erg& erg, Lhs const& lhs, Rhs const& rhs)
+  private:
+    static constexpr index_t offset(index_t const& row, index_t const& col) noexcept
     {
-      for (index_t col = 0; col < Erg::number_of_columns; col++)
-        for (index_t row = 0; row < Erg::number_of_rows; row++)
-          erg(row, col) = lhs(row, col) - rhs(row, col);
+      return row < col ? col * (col + 1) / 2 + row : row * (row + 1) / 2 + col;
     }
 
-    template <writeable_static_matrix_concept Erg, typename Lhs, typename Rhs>
-    requires readable_like_matrix_concept<Lhs, typename Erg::value_type>&& readable_like_matrix_concept<Rhs, typename Erg::value_type> constexpr void
-                                                                           mult(Erg& erg, Lhs const& lhs, Rhs const& rhs)
+    value_type m_data[number_of_stored_elements]{};
+  };
+
+  // square matrix that is zero outside the KL diagonals below and the KU diagonals above its main diagonal. the band is stored
+  // row by row, KL + KU + 1 elements per row; the first and last rows leave the elements unused that fall outside the matrix
+  template <index_t N, index_t KL, index_t KU, typename T> class banded_matrix_t
+  {
+  public:
+    using value_type                                   = std::remove_cvref_t<T>;
+    static constexpr index_t number_of_rows            = N;
+    static constexpr index_t number_of_columns         = N;
+    static constexpr index_t number_of_elements        = N * N;
+    static constexpr index_t lower_bandwidth           = KL;
+    static constexpr index_t upper_bandwidth           = KU;
+    static constexpr index_t bandwidth                 = KL + KU + 1;
+    static constexpr index_t number_of_stored_elements = N * bandwidth;
+
+    constexpr banded_matrix_t() noexcept = default;
+
+    // only the band of mat is read
+    template <readable_static_matrix_concept Mat>
+    requires(Mat::number_of_rows == N && Mat::number_of_columns == N) constexpr explicit banded_matrix_t(Mat const& mat) noexcept
     {
-      using T = typename Erg::value_type;
-      for (index_t col = 0; col < Erg::number_of_columns; col++)
-        for (index_t row = 0; row < Erg::number_of_rows; row++)
-        {
-          T tmp = 0;
-          for (index_t idx = 0; idx < Lhs::number_of_columns; idx++)
-            tmp += lhs(row, idx) * rhs(idx, col);
-          erg(row, col) = tmp;
-        }
+      for (index_t row = 0; row < N; row++)
+        for (index_t col = first_column(row); col < last_column(row); col++)
+          this->element(row, col) = mat(row, col);
     }
 
-    template <writeable_static_matrix_concept Erg, typename Val>
-    requires readable_like_matrix_concept<Val, typename Erg::value_type> constexpr void scale(Erg& erg, Val const& val, typename Val::value_type const& scale)
+    static constexpr bool contains(index_t const& row, index_t const& col) noexcept { return row <= col + KL && col <= row + KU; }
+
+    // the columns of the band in row are first_column(row) .. last_column(row) - 1, the rows of the band in col likewise
+    static constexpr index_t first_column(index_t const& row) noexcept { return row > KL ? row - KL : 0; }
+    static constexpr index_t last_column(index_t const& row) noexcept { return row + KU + 1 < N ? row + KU + 1 : N; }
+    static constexpr index_t first_row(index_t const& col) noexcept { return col > KU ? col - KU : 0; }
+    static constexpr index_t last_row(index_t const& col) noexcept { return col + KL + 1 < N ? col + KL + 1 : N; }
+
+    constexpr auto operator()(index_t const& row, index_t const& col) const noexcept -> value_type
     {
-      for (index_t col = 0; col < Erg::number_of_columns; col++)
-        for (index_t row = 0; row < Erg::number_of_rows; row++)
-          erg(row, col) = val(row, col) * scale;
+      if (contains(row, col))
+        return this->m_data[offset(row, col)];
+      return static_cast<value_type>(0);
     }
 
-    template <writeable_static_matrix_concept Lhs, writeable_static_matrix_concept Rhs>
-    requires(Lhs::number_of_rows == Lhs::number_of_columns && Lhs::number_of_rows == Rhs::number_of_rows) constexpr void solve(Lhs& val, Rhs& erg)
-    {
-      using value_type = typename Lhs::value_type;
+    // element (row, col) inside the band
+    constexpr auto element(index_t const& row, index_t const& col) const noexcept -> value_type const& { return this->m_data[offset(row, col)]; }
+    constexpr auto element(index_t const& row, index_t const& col) noexcept -> value_type& { return this->m_data[offset(row, col)]; }
 
-      auto swap_rows = [](auto& mat, index_t const& r1, index_t const& r2)
-      {
-        for (index_t col = 0; col < mat.number_of_columns; col++)
-          std::swap(mat(r1, col), mat(r2, col));
-      };
+  private:
+    static constexpr index_t offset(index_t const& row, index_t const& col) noexcept { return row * bandwidth + KL + col - row; }
 
-      auto div_row = [](auto& mat, value_type const& val, index_t const& row)
-      {
-        for (index_t col = 0; col < mat.number_of_columns; col++)
-          mat(row, col) /= val;
-      };
+    value_type m_data[number_of_stored_elements]{};
+  };
 
-      auto sub_scl_rows = [](auto& mat, value_type const& val, index_t const& r1, index_t const& r2)
-      {
-        for (index_t col = 0; col < mat.number_of_columns; col++)
-          mat(r1, col) -= mat(r2, col) * val;
-      };
+  template <index_t N, typename T> using tridiagonal_matrix_t = banded_matrix_t<N, 1, 1, T>;
 
-      for (index_t row = 0; row < Lhs::number_of_rows; row++)
-      {
-        {
-          index_t    sel_idx = row;
-          value_type fac     = val(row, row);
-          for (index_t idx = row + 1; idx < Lhs::number_of_rows; idx++)
-          {
-            if (std::abs(fac) < std::abs(val(idx, row)))
-            {
-              sel_idx = idx;
-              fac     = val(idx, row);
-            }
-          }
+  template <readable_static_matrix_concept T> class transpose_view_t
+  {
+  public:
+    using value_type                                    = std::remove_cvref_t<typename T::value_type>;
+    static constexpr index_t         number_of_rows     = T::number_of_columns;
+    static constexpr index_t         number_of_columns  = T::number_of_rows;
+    static constexpr index_t         number_of_elements = T::number_of_elements;
+    static constexpr storage_order_t storage_order      = Internal::transposed_storage_order<T>();
+    static constexpr index_t         leading_dimension  = Internal::leading_dimension<T>();
+
+    constexpr transpose_view_t(T const& obj)
+        : m_obj{ obj }
+    {
+    }
 
-          if (sel_idx != row)
-          {
-            swap_rows(val, sel_idx, row);
-            swap_rows(erg, sel_idx, row);
-          }
+    constexpr decltype(auto) operator()(index_t const& row, index_t const& col) const noexcept { return this->m_obj(col, row); }
 
-          if (fac != 1.0)
-          {
-            div_row(val, fac, row);
-            div_row(erg, fac, row);
-          }
-        }
+    constexpr auto base() const noexcept -> T const& { return this->m_obj; }
 
-        for (index_t idx = 0; idx < Lhs::number_of_rows; idx++)
-        {
-          if (idx == row)
-            continue;
-          value_type const fac = val(idx, row);
-          sub_scl_rows(val, fac, idx, row);
-          sub_scl_rows(erg, fac, idx, row);
-        }
-      }
-    }
-  }    // namespace Internal
-}    // namespace ExMath
+    // the buffer of a strided matrix read in the opposite order is its transpose
+    constexpr auto data() const noexcept -> value_type const* requires in_memory_matrix_concept<T> { return this->m_obj.data(); }
+    constexpr auto stride() const noexcept -> index_t requires runtime_strided_matrix_concept<T> { return this->m_obj.stride(); }
 
-namespace ExMath
-{
-  template <index_t rows, index_t columns, typename T> class static_matrix_t
+    template <typename Erg> constexpr bool references(Erg const& erg) const noexcept { return Internal::references(this->m_obj, erg); }
+    template <typename Erg> constexpr bool reads_displaced(Erg const& erg) const noexcept { return Internal::references(this->m_obj, erg); }
+
+  private:
+    T const& m_obj;
+  };
+
+  // rows x columns block of T starting at (row_offset, col_offset), read and written in place; read only unless T is writeable.
+  // a block of a strided matrix is strided with the leading dimension of the whole, so the kernels keep working on its buffer
+  template <index_t row_offset, index_t col_offset, index_t rows, index_t columns, typename T>
+  requires(readable_static_matrix_concept<std::remove_const_t<T>> && row_offset + rows <= T::number_of_rows &&
+           col_offset + columns <= T::number_of_columns) class block_view_t
   {
   public:
-    using value_type                            = std::remove_cvref_t<T>;
-    static constexpr index_t number_of_rows     = rows;
-    static constexpr index_t number_of_columns  = columns;
-    static constexpr index_t number_of_elements = rows * columns;
+    using value_type                                    = std::remove_cvref_t<typename T::value_type>;
+    static constexpr index_t         number_of_rows     = rows;
+    static constexpr index_t         number_of_columns  = columns;
+    static constexpr index_t         number_of_elements = rows * columns;
+    static constexpr storage_order_t storage_order      = Internal::preferred_storage_order<std::remove_const_t<T>>();
+    static constexpr index_t         leading_dimension  = Internal::leading_dimension<std::remove_const_t<T>>();
+
+    constexpr block_view_t(T& obj) noexcept
+        : m_obj{ obj }
+    {
+    }
 
-    constexpr static_matrix_t() noexcept = default;
+    constexpr block_view_t(block_view_t const&) noexcept = default;
 
-    template <typename Rhs> requires is_assignable<static_matrix_t, Rhs> constexpr static_matrix_t(Rhs const& rhs) noexcept { Internal::assign(*this, rhs); };
+    // assignment writes through to the viewed elements, also from another view of the same type
+    constexpr auto operator=(block_view_t const& rhs) noexcept -> block_view_t& { return this->operator= <block_view_t>(rhs); }
 
-    template <typename... Us>
-    requires std::is_convertible_v<std::common_type_t<Us...>, value_type> constexpr static_matrix_t(Us&&... args) noexcept
-        : m_data{ std::forward<Us>(args)... }
+    template <typename Rhs> requires is_assignable<block_view_t, Rhs> constexpr auto operator=(Rhs const& rhs) noexcept -> block_view_t&
     {
-      static_assert(sizeof...(Us) == number_of_elements);
-    };
+      if (Internal::is_aliased(*this, rhs))
+        Internal::assign(*this, static_matrix_t<rows, columns, value_type, storage_order>{ rhs });
+      else
+        Internal::assign(*this, rhs);
+      return *this;
+    }
 
-    constexpr auto operator()(index_t const& row, index_t const& col) const noexcept -> value_type const&
+    // the free compound assignments take an lvalue, these apply them to the view returned by block() / row() / col() directly
+    template <typename Rhs>
+    requires(writeable_static_matrix_concept<T> && readable_static_matrix_concept<Rhs> && is_same_size<block_view_t, Rhs>) constexpr auto
+    operator+=(Rhs const& rhs) && noexcept -> block_view_t&
+    {
+      if (Internal::is_aliased(*this, rhs))
+        Internal::add_assign(*this, static_matrix_t<rows, columns, value_type, storage_order>{ rhs });
+      else
+        Internal::add_assign(*this, rhs);
+      return *this;
+    }
+
+    template <typename Rhs>
+    requires(writeable_static_matrix_concept<T> && readable_static_matrix_concept<Rhs> && is_same_size<block_view_t, Rhs>) constexpr auto
+    operator-=(Rhs const& rhs) && noexcept -> block_view_t&
     {
-      return this->m_data[Internal::calc_index_row_major<number_of_rows, number_of_columns>(row, col)];
+      if (Internal::is_aliased(*this, rhs))
+        Internal::sub_assign(*this, static_matrix_t<rows, columns, value_type, storage_order>{ rhs });
+      else
+        Internal::sub_assign(*this, rhs);
+      return *this;
     }
 
-    constexpr auto operator()(index_t const& row, index_t const& col) noexcept -> value_type&
+    constexpr auto operator*=(value_type const& rhs) && noexcept -> block_view_t& requires(writeable_static_matrix_concept<T>)
     {
-      return this->m_data[Internal::calc_index_row_major<number_of_rows, number_of_columns>(row, col)];
+      Internal::mult_assign(*this, rhs);
+      return *this;
     }
 
-    template <typename Rhs> requires is_assignable<static_matrix_t, Rhs> constexpr auto operator=(Rhs const& rhs) noexcept
+    constexpr auto operator/=(value_type const& rhs) && noexcept -> block_view_t& requires(writeable_static_matrix_concept<T>)
     {
-      Internal::assign(*this, rhs);
+      Internal::div_assign(*this, rhs);
       return *this;
-    };
+    }
 
-  private:
-    value_type m_data[number_of_elements]{};
-  };
+    constexpr decltype(auto) operator()(index_t const& row, index_t const& col) const noexcept
+    {
+      return std::as_const(this->m_obj)(row + row_offset, col + col_offset);
+    }
 
-  template <index_t rows, index_t columns, typename T> class static_matrix_t<rows, columns, const T>
-  {
-  public:
-    using value_type                            = std::remove_cvref_t<T>;
-    static constexpr index_t number_of_rows     = rows;
-    static constexpr index_t number_of_columns  = columns;
-    static constexpr index_t number_of_elements = rows * columns;
+    constexpr auto operator()(index_t const& row, index_t const& col) noexcept -> value_type& requires(writeable_static_matrix_concept<T>)
+    {
+      return this->m_obj(row + row_offset, col + col_offset);
+    }
 
-    static_matrix_t(value_type const (&data)[number_of_elements])
-        : m_data{ data }
+    constexpr auto data() const noexcept -> value_type const* requires in_memory_matrix_concept<std::remove_const_t<T>>
     {
+      return std::as_const(this->m_obj).data() + this->offset();
     }
 
-    constexpr auto operator()(index_t const& row, index_t const& col) const noexcept -> value_type const&
+    constexpr auto data() noexcept -> value_type* requires(in_memory_matrix_concept<std::remove_const_t<T>> && writeable_static_matrix_concept<T>)
     {
-      return this->m_data[Internal::calc_index_row_major<number_of_rows, number_of_columns>(row, col)];
+      return this->m_obj.data() + this->offset();
     }
 
+    constexpr auto stride() const noexcept -> index_t requires runtime_strided_matrix_concept<std::remove_const_t<T>> { return this->m_obj.stride(); }
+
+    template <typename Erg> constexpr bool references(Erg const& erg) const noexcept { return Internal::references(this->m_obj, erg); }
+    template <typename Erg> constexpr bool reads_displaced(Erg const& erg) const noexcept { return Internal::references(this->m_obj, erg); }
+
   private:
-    value_type const (&m_data)[number_of_elements]{};
+    constexpr auto offset() const noexcept -> std::size_t
+    {
+      index_t const stride = Internal::stride_of(std::as_const(this->m_obj));
+      if constexpr (storage_order == storage_order_t::column_major)
+        return static_cast<std::size_t>(col_offset) * stride + row_offset;
+      else
+        return static_cast<std::size_t>(row_offset) * stride + col_offset;
+    }
+
+    T& m_obj;
   };
 
-  template <index_t rows, index_t columns, typename T> class static_matrix_external_memory_t
+  // lazy result of an elementwise operation; evaluated in a single pass once assigned to a matrix
+  template <typename Op, typename Lhs, typename Rhs> class elementwise_expression_t
   {
-  public:
-    using value_type                            = std::remove_cvref_t<T>;
-    static constexpr index_t number_of_rows     = rows;
-    static constexpr index_t number_of_columns  = columns;
-    static constexpr index_t number_of_elements = rows * columns;
+    using lhs_t = std::remove_cvref_t<Lhs>;
+    using rhs_t = std::remove_cvref_t<Rhs>;
 
-    static_matrix_external_memory_t(value_type (&data)[number_of_elements])
-        : m_data{ data }
+    static_assert(is_same_size<lhs_t, rhs_t>);
+
+  public:
+    using value_type                                    = std::remove_cvref_t<typename rhs_t::value_type>;
+    static constexpr index_t         number_of_rows     = rhs_t::number_of_rows;
+    static constexpr index_t         number_of_columns  = rhs_t::number_of_columns;
+    static constexpr index_t         number_of_elements = rhs_t::number_of_elements;
+    static constexpr storage_order_t storage_order      = Internal::preferred_storage_order<lhs_t, rhs_t>();
+    static constexpr bool            is_lazy_expression = true;
+
+    template <typename L, typename R>
+    constexpr elementwise_expression_t(L&& lhs, R&& rhs) noexcept
+        : m_lhs{ std::forward<L>(lhs) }
+        , m_rhs{ std::forward<R>(rhs) }
     {
     }
 
-    constexpr auto operator()(index_t const& row, index_t const& col) const noexcept -> value_type const&
+    constexpr auto operator()(index_t const& row, index_t const& col) const noexcept -> value_type
     {
-      return this->m_data[Internal::calc_index_row_major<number_of_rows, number_of_columns>(row, col)];
+      return Op::template apply<value_type>(this->m_lhs(row, col), this->m_rhs(row, col));
     }
 
-    constexpr auto operator()(index_t const& row, index_t const& col) noexcept -> value_type&
+    template <typename Erg> constexpr bool references(Erg const& erg) const noexcept
     {
-      return this->m_data[Internal::calc_index_row_major<number_of_rows, number_of_columns>(row, col)];
+      return Internal::references(this->m_lhs, erg) || Internal::references(this->m_rhs, erg);
     }
-
-    template <typename Rhs> requires is_assignable<static_matrix_t, Rhs> constexpr auto operator=(Rhs const& rhs) noexcept
+    template <typename Erg> constexpr bool reads_displaced(Erg const& erg) const noexcept
     {
-      Internal::assign(*this, rhs);
-      return *this;
-    };
+      return Internal::reads_displaced(this->m_lhs, erg) || Internal::reads_displaced(this->m_rhs, erg);
+    }
 
   private:
-    value_type (&m_data)[number_of_elements]{};
+    Internal::expression_operand_t<Lhs> m_lhs;
+    Internal::expression_operand_t<Rhs> m_rhs;
   };
 
-  template <index_t rows, index_t columns, typename T> class identity_matrix_t
+  // lazy product of a matrix and a scalar
+  template <typename Val> class scale_expression_t
   {
-  public:
-    using value_type                            = std::remove_cvref_t<T>;
-    static constexpr index_t number_of_rows     = rows;
-    static constexpr index_t number_of_columns  = columns;
-    static constexpr index_t number_of_elements = rows * columns;
+    using val_t = std::remove_cvref_t<Val>;
 
-    constexpr auto operator()(index_t const& row, index_t const& col) const noexcept -> value_type
+  public:
+    using value_type                                    = std::remove_cvref_t<typename val_t::value_type>;
+    static constexpr index_t         number_of_rows     = val_t::number_of_rows;
+    static constexpr index_t         number_of_columns  = val_t::number_of_columns;
+    static constexpr index_t         number_of_elements = val_t::number_of_elements;
+    static constexpr storage_order_t storage_order      = Internal::preferred_storage_order<val_t>();
+    static constexpr bool            is_lazy_expression = true;
+
+    template <typename V>
+    constexpr scale_expression_t(V&& val, value_type const& scale) noexcept
+        : m_val{ std::forward<V>(val) }
+        , m_scale{ scale }
     {
-      if (row == col)
-        return static_cast<value_type>(1);
-      return static_cast<value_type>(0);
     }
+
+    constexpr auto operator()(index_t const& row, index_t const& col) const noexcept -> value_type { return this->m_val(row, col) * this->m_scale; }
+
+    template <typename Erg> constexpr bool references(Erg const& erg) const noexcept { return Internal::references(this->m_val, erg); }
+    template <typename Erg> constexpr bool reads_displaced(Erg const& erg) const noexcept { return Internal::reads_displaced(this->m_val, erg); }
+
+  private:
+    Internal::expression_operand_t<Val> m_val;
+    value_type                          m_scale;
   };
 
-  template <readable_static_matrix_concept T> class transpose_view_t
+  // val + diag or val - diag for a diag that is nonzero only on the main diagonal
+  template <typename Op, typename Val, typename Diag> class diagonal_shift_expression_t
   {
+    using val_t = std::remove_cvref_t<Val>;
+
   public:
-    using value_type                            = std::remove_cvref_t<typename T::value_type>;
-    static constexpr index_t number_of_rows     = T::number_of_columns;
-    static constexpr index_t number_of_columns  = T::number_of_rows;
-    static constexpr index_t number_of_elements = T::number_of_elements;
+    using value_type                                    = std::remove_cvref_t<typename val_t::value_type>;
+    using operation_type                                = Op;
+    static constexpr index_t         number_of_rows     = val_t::number_of_rows;
+    static constexpr index_t         number_of_columns  = val_t::number_of_columns;
+    static constexpr index_t         number_of_elements = val_t::number_of_elements;
+    static constexpr storage_order_t storage_order      = Internal::preferred_storage_order<val_t>();
+    static constexpr bool            is_lazy_expression = true;
+
+    template <typename V, typename D>
+    constexpr diagonal_shift_expression_t(V&& val, D&& diag) noexcept
+        : m_val{ std::forward<V>(val) }
+        , m_diag{ std::forward<D>(diag) }
+    {
+    }
 
-    transpose_view_t(T const& obj)
-        : m_obj{ obj }
+    constexpr auto operator()(index_t const& row, index_t const& col) const noexcept -> value_type
     {
+      if (row == col)
+        return Op::template apply<value_type>(this->m_val(row, col), this->m_diag(row, col));
+      return this->m_val(row, col);
     }
 
-    constexpr auto operator()(index_t const& row, index_t const& col) const noexcept -> value_type const& { return this->m_obj(col, row); }
+    constexpr auto operand() const noexcept -> val_t const& { return this->m_val; }
+    constexpr auto diagonal_operand() const noexcept -> std::remove_cvref_t<Diag> const& { return this->m_diag; }
+
+    template <typename Erg> constexpr bool references(Erg const& erg) const noexcept { return Internal::references(this->m_val, erg); }
+    template <typename Erg> constexpr bool reads_displaced(Erg const& erg) const noexcept { return Internal::reads_displaced(this->m_val, erg); }
 
   private:
-    T const& m_obj;
+    Internal::expression_operand_t<Val>  m_val;
+    Internal::expression_operand_t<Diag> m_diag;
   };
 
-  template <index_t rows, index_t columns, typename T> using matrix_view_t = static_matrix_t<rows, columns, const T>;
+  template <index_t rows, index_t columns, typename T, storage_order_t order = storage_order_t::row_major>
+  using matrix_view_t = static_matrix_t<rows, columns, const T, order>;
 }    // namespace ExMath
 
 namespace ExMath
 {
+  namespace Internal
+  {
+    // products read every operand element several times, so lazy operands are evaluated once up front
+    template <readable_static_matrix_concept T> constexpr decltype(auto) materialize(T const& obj) noexcept
+    {
+      if constexpr (lazy_expression_concept<T>)
+        return static_matrix_t<T::number_of_rows, T::number_of_columns, typename T::value_type, T::storage_order>{ obj };
+      else
+        return (obj);
+    }
+
+    // lhs op rhs for two square matrices that are nonzero only on their diagonals
+    template <typename Op, typename Lhs, typename Rhs> constexpr auto diagonal_combine(Lhs const& lhs, Rhs const& rhs) noexcept
+    {
+      diagonal_matrix_t<Lhs::number_of_rows, typename Lhs::value_type> erg;
+      for (index_t idx = 0; idx < Lhs::number_of_rows; idx++)
+        erg.diagonal(idx) = Op::template apply<typename Lhs::value_type>(lhs(idx, idx), rhs(idx, idx));
+      return erg;
+    }
+
+    // lhs op rhs for two symmetric operands of which at least one is a symmetric_matrix_t; each unique element is computed once
+    template <typename Op, typename Lhs, typename Rhs> constexpr auto symmetric_combine(Lhs const& lhs, Rhs const& rhs) noexcept
+    {
+      using T   = typename Lhs::value_type;
+      using Erg = symmetric_matrix_t<Lhs::number_of_rows, T>;
+
+      Erg erg;
+      if constexpr (is_symmetric_matrix<Lhs> && is_symmetric_matrix<Rhs>)
+      {
+        for_each_stored<Erg>([&](index_t const& idx) { erg.data()[idx] = Op::template apply<T>(lhs.data()[idx], rhs.data()[idx]); });
+      }
+      else if constexpr (is_symmetric_matrix<Lhs>)
+      {
+        // the other operand is diagonal, so only the diagonal changes
+        erg = lhs;
+        for_each_diagonal<Erg>([&](index_t const& idx) { erg.element(idx, idx) = Op::template apply<T>(erg.element(idx, idx), rhs(idx, idx)); });
+      }
+      else
+      {
+        for (index_t row = 0; row < Erg::number_of_rows; row++)
+          for (index_t col = 0; col <= row; col++)
+            erg.element(row, col) = Op::template apply<T>(lhs(row, col), rhs(row, col));
+      }
+      return erg;
+    }
+
+    // val * scale; symmetric matrices are scaled right away and stay symmetric, everything else is scaled lazily
+    template <typename Val> constexpr auto scaled(Val&& val, typename std::remove_cvref_t<Val>::value_type const& scale) noexcept
+    {
+      using T = std::remove_cvref_t<Val>;
+      if constexpr (is_symmetric_matrix<T>)
+      {
+        T erg;
+        for_each_stored<T>([&](index_t const& idx) { erg.data()[idx] = val.data()[idx] * scale; });
+        return erg;
+      }
+      else
+      {
+        return scale_expression_t<Val>{ std::forward<Val>(val), scale };
+      }
+    }
+
+    // an operand a folded operation reduces to: lvalues are passed on as they are, temporaries are kept by value
+    template <typename T> constexpr decltype(auto) folded(T&& obj) noexcept
+    {
+      if constexpr (std::is_lvalue_reference_v<T>)
+        return std::as_const(obj);
+      else
+        return std::remove_cvref_t<T>{ std::move(obj) };
+    }
+  }    // namespace Internal
+
   template <typename Erg, typename Rhs>
   requires(writeable_static_matrix_concept<Erg>&& readable_static_matrix_concept<Rhs>&& is_same_size<Erg, Rhs>) constexpr auto
   operator+=(Erg& erg, Rhs const& rhs) noexcept
   {
-    Internal::add_assign(erg, rhs);
+    if (Internal::is_aliased(erg, rhs))
+      Internal::add_assign(erg, static_matrix_t<Rhs::number_of_rows, Rhs::number_of_columns, typename Rhs::value_type>{ rhs });
+    else
+      Internal::add_assign(erg, rhs);
     return erg;
   }
 
@@ -362,7 +2253,10 @@ namespace ExMath
   requires(writeable_static_matrix_concept<Erg>&& readable_static_matrix_concept<Rhs>&& is_same_size<Erg, Rhs>) constexpr auto
   operator-=(Erg& erg, Rhs const& rhs) noexcept
   {
-    Internal::sub_assign(erg, rhs);
+    if (Internal::is_aliased(erg, rhs))
+      Internal::sub_assign(erg, static_matrix_t<Rhs::number_of_rows, Rhs::number_of_columns, typename Rhs::value_type>{ rhs });
+    else
+      Internal::sub_assign(erg, rhs);
     return erg;
   }
 
@@ -379,95 +2273,268 @@ namespace ExMath
   }
 
   template <typename Lhs, typename Rhs>
-  requires(readable_static_matrix_concept<Lhs>&& readable_static_matrix_concept<Rhs>&& is_same_size<Lhs, Rhs>) constexpr auto operator+(Lhs const& lhs,
-                                                                                                                                        Rhs const& rhs) noexcept
+  requires(readable_static_matrix_concept<std::remove_cvref_t<Lhs>>&& readable_static_matrix_concept<std::remove_cvref_t<Rhs>>&&
+               is_same_size<std::remove_cvref_t<Lhs>, std::remove_cvref_t<Rhs>>) constexpr auto
+  operator+(Lhs&& lhs, Rhs&& rhs) noexcept -> decltype(auto)
   {
-    using Erg = static_matrix_t<Rhs::number_of_rows, Rhs::number_of_columns, typename Rhs::value_type>;
-    Erg erg;
-    Internal::add(erg, lhs, rhs);
-    return erg;
+    using lhs_t = std::remove_cvref_t<Lhs>;
+    using rhs_t = std::remove_cvref_t<Rhs>;
+
+    if constexpr (is_zero_matrix<rhs_t>)
+      return Internal::folded(std::forward<Lhs>(lhs));
+    else if constexpr (is_zero_matrix<lhs_t>)
+      return Internal::folded(std::forward<Rhs>(rhs));
+    else if constexpr (is_diagonal_structure<lhs_t> && is_diagonal_structure<rhs_t> && (is_diagonal_matrix<lhs_t> || is_diagonal_matrix<rhs_t>))
+      return Internal::diagonal_combine<Internal::add_op_t>(lhs, rhs);
+    else if constexpr (is_symmetric_structure<lhs_t> && is_symmetric_structure<rhs_t> && (is_symmetric_matrix<lhs_t> || is_symmetric_matrix<rhs_t>))
+      return Internal::symmetric_combine<Internal::add_op_t>(lhs, rhs);
+    else if constexpr (is_diagonal_structure<rhs_t>)
+      return diagonal_shift_expression_t<Internal::add_op_t, Lhs, Rhs>{ std::forward<Lhs>(lhs), std::forward<Rhs>(rhs) };
+    else if constexpr (is_diagonal_structure<lhs_t>)
+      return diagonal_shift_expression_t<Internal::add_op_t, Rhs, Lhs>{ std::forward<Rhs>(rhs), std::forward<Lhs>(lhs) };
+    else
+      return elementwise_expression_t<Internal::add_op_t, Lhs, Rhs>{ std::forward<Lhs>(lhs), std::forward<Rhs>(rhs) };
   }
 
   template <typename Lhs, typename Rhs>
-  requires(readable_static_matrix_concept<Lhs>&& readable_static_matrix_concept<Rhs>&& is_same_size<Lhs, Rhs>) constexpr auto operator-(Lhs const& lhs,
-                                                                                                                                        Rhs const& rhs) noexcept
+  requires(readable_static_matrix_concept<std::remove_cvref_t<Lhs>>&& readable_static_matrix_concept<std::remove_cvref_t<Rhs>>&&
+               is_same_size<std::remove_cvref_t<Lhs>, std::remove_cvref_t<Rhs>>) constexpr auto
+  operator-(Lhs&& lhs, Rhs&& rhs) noexcept -> decltype(auto)
   {
-    using Erg = static_matrix_t<Rhs::number_of_rows, Rhs::number_of_columns, typename Rhs::value_type>;
-    Erg erg;
-    Internal::sub(erg, lhs, rhs);
-    return erg;
+    using lhs_t = std::remove_cvref_t<Lhs>;
+    using rhs_t = std::remove_cvref_t<Rhs>;
+
+    if constexpr (is_zero_matrix<rhs_t>)
+      return Internal::folded(std::forward<Lhs>(lhs));
+    else if constexpr (is_zero_matrix<lhs_t>)
+      return scale_expression_t<Rhs>{ std::forward<Rhs>(rhs), static_cast<typename rhs_t::value_type>(-1) };
+    else if constexpr (is_diagonal_structure<lhs_t> && is_diagonal_structure<rhs_t> && (is_diagonal_matrix<lhs_t> || is_diagonal_matrix<rhs_t>))
+      return Internal::diagonal_combine<Internal::sub_op_t>(lhs, rhs);
+    else if constexpr (is_symmetric_structure<lhs_t> && is_symmetric_structure<rhs_t> && (is_symmetric_matrix<lhs_t> || is_symmetric_matrix<rhs_t>))
+      return Internal::symmetric_combine<Internal::sub_op_t>(lhs, rhs);
+    else if constexpr (is_diagonal_structure<rhs_t>)
+      return diagonal_shift_expression_t<Internal::sub_op_t, Lhs, Rhs>{ std::forward<Lhs>(lhs), std::forward<Rhs>(rhs) };
+    else
+      return elementwise_expression_t<Internal::sub_op_t, Lhs, Rhs>{ std::forward<Lhs>(lhs), std::forward<Rhs>(rhs) };
   }
 
   template <typename Lhs, typename Rhs>
   requires(readable_static_matrix_concept<Lhs>&& readable_static_matrix_concept<Rhs>&& Lhs::number_of_columns == Rhs::number_of_rows) constexpr auto
   operator*(Lhs const& lhs, Rhs const& rhs) noexcept
   {
-    using Erg = static_matrix_t<Lhs::number_of_rows, Rhs::number_of_columns, typename Lhs::value_type>;
-    Erg erg;
-    Internal::mult(erg, lhs, rhs);
-    return erg;
+    using Erg = static_matrix_t<Lhs::number_of_rows, Rhs::number_of_columns, typename Lhs::value_type, Internal::preferred_storage_order<Lhs, Rhs>()>;
+
+    constexpr bool square_left  = Lhs::number_of_rows == Lhs::number_of_columns;
+    constexpr bool square_right = Rhs::number_of_rows == Rhs::number_of_columns;
+
+    // products with a zero or a square identity need no arithmetic at all
+    if constexpr (is_zero_matrix<Lhs> || is_zero_matrix<Rhs>)
+    {
+      return zero_matrix_t<Lhs::number_of_rows, Rhs::number_of_columns, typename Lhs::value_type>{};
+    }
+    else if constexpr (is_identity_matrix<Lhs> && is_identity_matrix<Rhs> && square_left && square_right)
+    {
+      return lhs;
+    }
+    else if constexpr (is_identity_matrix<Rhs> && square_right)
+    {
+      if constexpr (is_diagonal_matrix<Lhs>)
+        return lhs;
+      else
+        return Erg{ lhs };
+    }
+    else if constexpr (is_identity_matrix<Lhs> && square_left)
+    {
+      if constexpr (is_diagonal_matrix<Rhs>)
+        return rhs;
+      else
+        return Erg{ rhs };
+    }
+    else if constexpr (is_diagonal_matrix<Lhs> && is_diagonal_matrix<Rhs>)
+    {
+      return Internal::diagonal_combine<Internal::mul_op_t>(lhs, rhs);
+    }
+    else if constexpr (is_same_triangle<Lhs, Rhs>)
+    {
+      // products of two lower or two upper triangles stay in that triangle, stored like lhs
+      triangular_matrix_t<Lhs::number_of_rows, typename Lhs::value_type, Lhs::triangle, Lhs::triangle_storage> erg;
+      Internal::triangular_mult(erg, typename Erg::value_type{ 1 }, lhs, Internal::materialize(rhs), typename Erg::value_type{ 0 });
+      return erg;
+    }
+    else if constexpr (is_diagonal_matrix<Lhs> || is_diagonal_matrix<Rhs>)
+    {
+      // every element of the other operand is read once, so lazy operands are not materialized
+      Erg erg;
+      Internal::diagonal_mult(erg, typename Erg::value_type{ 1 }, lhs, rhs, typename Erg::value_type{ 0 });
+      return erg;
+    }
+    else
+    {
+      Erg erg;
+      Internal::mult(erg, Internal::materialize(lhs), Internal::materialize(rhs));
+      return erg;
+    }
   }
 
   template <typename Val, typename Scl>
-  requires(readable_static_matrix_concept<Val>&& readable_static_matrix_concept<Scl> && !is_scalar<Val> && is_scalar<Scl>) constexpr auto
-  operator*(Val const& val, Scl const& scale) noexcept
+  requires(readable_static_matrix_concept<std::remove_cvref_t<Val>>&& readable_static_matrix_concept<Scl> && !is_scalar<std::remove_cvref_t<Val>> &&
+           is_scalar<Scl>) constexpr auto
+  operator*(Val&& val, Scl const& scale) noexcept
   {
-    using Erg = static_matrix_t<Val::number_of_rows, Val::number_of_columns, typename Val::value_type>;
-    Erg erg;
-    Internal::scale(erg, val, scale(0, 0));
-    return erg;
+    return Internal::scaled(std::forward<Val>(val), scale(0, 0));
   }
 
   template <typename Val, typename Scl>
-  requires(readable_static_matrix_concept<Val>&& readable_static_matrix_concept<Scl> && !is_scalar<Val> && is_scalar<Scl>) constexpr auto
-  operator*(Scl const& scale, Val const& val) noexcept
+  requires(readable_static_matrix_concept<std::remove_cvref_t<Val>>&& readable_static_matrix_concept<Scl> && !is_scalar<std::remove_cvref_t<Val>> &&
+           is_scalar<Scl>) constexpr auto
+  operator*(Scl const& scale, Val&& val) noexcept
+  {
+    return Internal::scaled(std::forward<Val>(val), scale(0, 0));
+  }
+
+  template <typename Val>
+  requires(readable_static_matrix_concept<std::remove_cvref_t<Val>>) constexpr auto
+  operator*(Val&& val, typename std::remove_cvref_t<Val>::value_type const& scale) noexcept
+  {
+    return Internal::scaled(std::forward<Val>(val), scale);
+  }
+
+  template <typename Val>
+  requires(readable_static_matrix_concept<std::remove_cvref_t<Val>>) constexpr auto
+  operator*(typename std::remove_cvref_t<Val>::value_type const& scale, Val&& val) noexcept
+  {
+    return Internal::scaled(std::forward<Val>(val), scale);
+  }
+
+  // erg = alpha * lhs * rhs + beta * erg in one pass over erg; erg is not read if beta is zero
+  template <typename Erg, typename Lhs, typename Rhs>
+  requires(writeable_static_matrix_concept<Erg>&& readable_static_matrix_concept<Lhs>&& readable_static_matrix_concept<Rhs>&&
+                   Lhs::number_of_columns == Rhs::number_of_rows && Erg::number_of_rows == Lhs::number_of_rows &&
+               Erg::number_of_columns == Rhs::number_of_columns) constexpr void
+  gemm(Erg& erg, typename Erg::value_type const& alpha, Lhs const& lhs, Rhs const& rhs, typename Erg::value_type const& beta) noexcept
+  {
+    using T = typename Erg::value_type;
+    if constexpr (is_zero_matrix<Lhs> || is_zero_matrix<Rhs>)
+    {
+      if (beta == T{ 0 })
+        Internal::assign(erg, zero_matrix_t<Erg::number_of_rows, Erg::number_of_columns, T>{});
+      else
+        Internal::mult_assign(erg, beta);
+      return;
+    }
+
+    decltype(auto) a = Internal::materialize(lhs);
+    decltype(auto) b = Internal::materialize(rhs);
+
+    if (Internal::is_overlapping(erg, a) || Internal::is_overlapping(erg, b))
+    {
+      static_matrix_t<Erg::number_of_rows, Erg::number_of_columns, typename Erg::value_type, Internal::preferred_storage_order<Erg>()> tmp = erg;
+      Internal::gemm(tmp, alpha, a, b, beta);
+      Internal::assign(erg, tmp);
+    }
+    else
+    {
+      Internal::gemm(erg, alpha, a, b, beta);
+    }
+  }
+
+  // val * transpose(val), exactly symmetric
+  template <readable_static_matrix_concept Val> constexpr auto gram(Val const& val) noexcept
   {
-    using Erg = static_matrix_t<Val::number_of_rows, Val::number_of_columns, typename Val::value_type>;
-    Erg erg;
-    Internal::scale(erg, val, scale(0, 0));
+    using Erg = static_matrix_t<Val::number_of_rows, Val::number_of_rows, typename Val::value_type, Internal::preferred_storage_order<Val>()>;
+    decltype(auto) a = Internal::materialize(val);
+    Erg            erg;
+    Internal::symmetric_mult(erg, a, transpose_view_t<std::remove_cvref_t<decltype(a)>>{ a });
     return erg;
   }
 
-  template <typename Val> requires(readable_static_matrix_concept<Val>) constexpr auto operator*(Val const& val, typename Val::value_type const& scale) noexcept
+  // transpose(val) * val, exactly symmetric
+  template <readable_static_matrix_concept Val> constexpr auto gram_t(Val const& val) noexcept
   {
-    using Erg = static_matrix_t<Val::number_of_rows, Val::number_of_columns, typename Val::value_type>;
-    Erg erg;
-    Internal::scale(erg, val, scale);
+    using Erg = static_matrix_t<Val::number_of_columns, Val::number_of_columns, typename Val::value_type, Internal::preferred_storage_order<Val>()>;
+    decltype(auto) a = Internal::materialize(val);
+    Erg            erg;
+    Internal::symmetric_mult(erg, transpose_view_t<std::remove_cvref_t<decltype(a)>>{ a }, a);
     return erg;
   }
 
-  template <typename Val> requires(readable_static_matrix_concept<Val>) constexpr auto operator*(typename Val::value_type const& scale, Val const& val) noexcept
+  // erg = alpha * val * transpose(val) + beta * erg, the symmetric rank-k update; only the unique elements of erg are computed.
+  // erg is not read if beta is zero
+  template <index_t N, typename T, readable_static_matrix_concept Val>
+  requires(Val::number_of_rows == N) constexpr void syrk(symmetric_matrix_t<N, T>& erg, T const& alpha, Val const& val, T const& beta) noexcept
+  {
+    decltype(auto) a = Internal::materialize(val);
+    using A          = std::remove_cvref_t<decltype(a)>;
+    if (Internal::references(a, erg))
+    {
+      // val reads erg, directly or through a view
+      using Tmp = std::conditional_t<std::is_same_v<A, symmetric_matrix_t<N, T>>,
+                                     symmetric_matrix_t<N, T>,
+                                     static_matrix_t<N, Val::number_of_columns, T, Internal::preferred_storage_order<A>()>>;
+      Tmp const tmp(a);
+      Internal::symmetric_rank_k(erg, alpha, tmp, beta);
+      return;
+    }
+    Internal::symmetric_rank_k(erg, alpha, a, beta);
+  }
+
+  // fnc * sym * transpose(fnc) for a symmetric sym, e.g. the propagation of a covariance; the result is exactly symmetric
+  template <readable_static_matrix_concept Fnc, readable_static_matrix_concept Sym>
+  requires(Sym::number_of_rows == Sym::number_of_columns && Fnc::number_of_columns == Sym::number_of_rows) constexpr auto sandwich(Fnc const& fnc,
+                                                                                                                              Sym const& sym) noexcept
   {
-    using Erg = static_matrix_t<Val::number_of_rows, Val::number_of_columns, typename Val::value_type>;
-    Erg erg;
-    Internal::scale(erg, val, scale);
+    using Erg        = static_matrix_t<Fnc::number_of_rows, Fnc::number_of_rows, typename Fnc::value_type, Internal::preferred_storage_order<Fnc>()>;
+    decltype(auto) f = Internal::materialize(fnc);
+    auto const     t = f * sym;
+    Erg            erg;
+    Internal::symmetric_mult(erg, t, transpose_view_t<std::remove_cvref_t<decltype(f)>>{ f });
     return erg;
   }
 
   template <readable_static_matrix_concept T> constexpr auto transpose(T const& val) { return transpose_view_t<T>{ val }; }
 
-  template <readable_static_matrix_concept T> requires(T::number_of_rows == T::number_of_columns) constexpr auto inverse(T const& mat)
+  // the transpose of a transpose is the matrix itself, also for the temporary view returned by an inner transpose()
+  template <readable_static_matrix_concept T> constexpr auto transpose(transpose_view_t<T> const& val) noexcept -> T const& { return val.base(); }
+  template <readable_static_matrix_concept T> constexpr auto transpose(transpose_view_t<T>&& val) noexcept -> T const& { return val.base(); }
+
+  // a view would outlive a temporary, so temporaries are transposed into a new matrix
+  template <readable_static_matrix_concept T> requires(!std::is_lvalue_reference_v<T>) constexpr auto transpose(T&& val)
   {
-    using value_type = typename T::value_type;
-    using mat_t      = static_matrix_t<T::number_of_rows, T::number_of_columns, value_type>;
+    using Erg = static_matrix_t<T::number_of_columns, T::number_of_rows, typename T::value_type, Internal::transposed_storage_order<T>()>;
+    return Erg{ transpose_view_t<T>{ val } };
+  }
 
-    mat_t erg = identity_matrix_t<mat_t::number_of_rows, mat_t::number_of_columns, value_type>();
-    mat_t val = mat;
-    Internal::solve(val, erg);
+  // value * identity, stored as its diagonal
+  template <index_t N, typename T> constexpr auto scaled_identity(T const& value) noexcept
+  {
+    diagonal_matrix_t<N, T> erg;
+    for (index_t idx = 0; idx < N; idx++)
+      erg.diagonal(idx) = value;
     return erg;
   }
 
-  template <readable_static_matrix_concept Lhs, readable_static_matrix_concept Rhs>
-  requires(Lhs::number_of_rows == Lhs::number_of_columns && Lhs::number_of_rows == Rhs::number_of_rows) constexpr auto solve(Lhs const& mat, Rhs const& b)
+  template <index_t row_offset, index_t col_offset, index_t rows, index_t columns, typename T>
+  requires readable_static_matrix_concept<std::remove_const_t<T>> constexpr auto block(T& val) noexcept
+  {
+    return block_view_t<row_offset, col_offset, rows, columns, T>{ val };
+  }
+
+  // a view would outlive a temporary, so blocks of temporaries are copied into a new matrix
+  template <index_t row_offset, index_t col_offset, index_t rows, index_t columns, readable_static_matrix_concept T>
+  requires(!std::is_lvalue_reference_v<T>) constexpr auto block(T&& val) noexcept
   {
-    using value_type = typename Lhs::value_type;
-    using mat_lhs_t  = static_matrix_t<Lhs::number_of_rows, Lhs::number_of_columns, value_type>;
-    using mat_rhs_t  = static_matrix_t<Rhs::number_of_rows, Rhs::number_of_columns, value_type>;
+    using Erg = static_matrix_t<rows, columns, typename T::value_type, Internal::preferred_storage_order<T>()>;
+    return Erg{ block_view_t<row_offset, col_offset, rows, columns, T const>{ val } };
+  }
 
-    mat_lhs_t val = mat;
-    mat_rhs_t erg = b;
-    Internal::solve(val, erg);
-    return erg;
+  template <index_t idx, typename T> requires readable_static_matrix_concept<std::remove_cvref_t<T>> constexpr auto row(T&& val) noexcept
+  {
+    return block<idx, 0, 1, std::remove_cvref_t<T>::number_of_columns>(std::forward<T>(val));
+  }
+
+  template <index_t idx, typename T> requires readable_static_matrix_concept<std::remove_cvref_t<T>> constexpr auto col(T&& val) noexcept
+  {
+    return block<0, idx, std::remove_cvref_t<T>::number_of_rows, 1>(std::forward<T>(val));
   }
 }    // namespace ExMath
 
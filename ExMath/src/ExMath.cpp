@@ -1,2 +1,586 @@
 #include <ExMath.hpp>
+#include <algorithm>
+#include <atomic>
 
+// every kernel below is instantiated once per isa_t: the variant wrappers carry a target attribute and the kernels are forced
+// inline into them, so each wrapper holds its own copy of the loops compiled for that instruction set
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define EXMATH_RUNTIME_DISPATCH 1
+#define EXMATH_KERNEL_INLINE    [[gnu::always_inline]] inline
+#define EXMATH_TARGET_AVX2      [[gnu::target("avx2,fma")]]
+#define EXMATH_TARGET_AVX512    [[gnu::target("avx512f,avx2,fma")]]
+#else
+#define EXMATH_RUNTIME_DISPATCH 0
+#define EXMATH_KERNEL_INLINE    inline
+#endif
+
+namespace
+{
+  namespace N = ExMath;
+  using N::index_t;
+  using N::Internal::strided_ref_t;
+
+  namespace kernels
+  {
+    template <typename T> EXMATH_KERNEL_INLINE void add(T* erg, T const* lhs, T const* rhs, std::size_t count) noexcept
+    {
+      for (std::size_t idx = 0; idx < count; idx++)
+        erg[idx] = lhs[idx] + rhs[idx];
+    }
+
+    template <typename T> EXMATH_KERNEL_INLINE void sub(T* erg, T const* lhs, T const* rhs, std::size_t count) noexcept
+    {
+      for (std::size_t idx = 0; idx < count; idx++)
+        erg[idx] = lhs[idx] - rhs[idx];
+    }
+
+    template <typename T> EXMATH_KERNEL_INLINE strided_ref_t<T> transposed(strided_ref_t<T> const& ref) noexcept
+    {
+      return { ref.data, ref.column_stride, ref.row_stride };
+    }
+
+    template <typename T> EXMATH_KERNEL_INLINE void scale_row(T* dst, index_t columns, T beta) noexcept
+    {
+      if (beta == T{ 0 })
+        for (index_t col = 0; col < columns; col++)
+          dst[col] = T{ 0 };
+      else if (beta != T{ 1 })
+        for (index_t col = 0; col < columns; col++)
+          dst[col] *= beta;
+    }
+
+    // gemm for an erg with unit column stride: rows of rhs with unit stride are read in place, any other rhs (e.g. a transposed
+    // operand) is packed block by block into row major order first, so the innermost loop always runs over contiguous memory
+    template <typename T>
+    EXMATH_KERNEL_INLINE void gemm_rows(index_t rows, index_t columns, index_t depth, T alpha, strided_ref_t<T const> lhs, strided_ref_t<T const> rhs, T beta,
+                                        strided_ref_t<T> erg) noexcept
+    {
+      if (rhs.column_stride == 1)
+      {
+        for (index_t row = 0; row < rows; row++)
+        {
+          T*       dst = erg.data + static_cast<std::size_t>(row) * erg.row_stride;
+          T const* a   = lhs.data + static_cast<std::size_t>(row) * lhs.row_stride;
+          scale_row(dst, columns, beta);
+          for (index_t k = 0; k < depth; k++)
+          {
+            T const  fac = alpha * a[k * lhs.column_stride];
+            T const* src = rhs.data + static_cast<std::size_t>(k) * rhs.row_stride;
+            for (index_t col = 0; col < columns; col++)
+              dst[col] += fac * src[col];
+          }
+        }
+        return;
+      }
+
+      constexpr index_t block = 64;
+      T                 packed[block * block];
+
+      for (index_t row = 0; row < rows; row++)
+        scale_row(erg.data + static_cast<std::size_t>(row) * erg.row_stride, columns, beta);
+
+      for (index_t k0 = 0; k0 < depth; k0 += block)
+      {
+        index_t const kb = std::min(block, depth - k0);
+        for (index_t j0 = 0; j0 < columns; j0 += block)
+        {
+          index_t const jb = std::min(block, columns - j0);
+          for (index_t j = 0; j < jb; j++)
+          {
+            T const* src = rhs.data + static_cast<std::size_t>(j0 + j) * rhs.column_stride + static_cast<std::size_t>(k0) * rhs.row_stride;
+            for (index_t k = 0; k < kb; k++)
+              packed[k * jb + j] = src[k * rhs.row_stride];
+          }
+
+          for (index_t row = 0; row < rows; row++)
+          {
+            T*       dst = erg.data + static_cast<std::size_t>(row) * erg.row_stride + j0;
+            T const* a   = lhs.data + static_cast<std::size_t>(row) * lhs.row_stride + static_cast<std::size_t>(k0) * lhs.column_stride;
+            for (index_t k = 0; k < kb; k++)
+            {
+              T const  fac = alpha * a[k * lhs.column_stride];
+              T const* src = packed + k * jb;
+              for (index_t j = 0; j < jb; j++)
+                dst[j] += fac * src[j];
+            }
+          }
+        }
+      }
+    }
+
+    template <typename T>
+    EXMATH_KERNEL_INLINE void gemm(index_t rows, index_t columns, index_t depth, T alpha, strided_ref_t<T const> lhs, strided_ref_t<T const> rhs, T beta,
+                                   strided_ref_t<T> erg) noexcept
+    {
+      if (erg.column_stride == 1)
+        return gemm_rows(rows, columns, depth, alpha, lhs, rhs, beta, erg);
+
+      // a column major erg is the row major result of the transposed product, erg^T = rhs^T * lhs^T
+      if (erg.row_stride == 1)
+        return gemm_rows(columns, rows, depth, alpha, transposed(rhs), transposed(lhs), beta, transposed(erg));
+
+      for (index_t row = 0; row < rows; row++)
+      {
+        T* dst = erg.data + static_cast<std::size_t>(row) * erg.row_stride;
+
+        if (beta == T{ 0 })
+          for (index_t col = 0; col < columns; col++)
+            dst[col * erg.column_stride] = T{ 0 };
+        else if (beta != T{ 1 })
+          for (index_t col = 0; col < columns; col++)
+            dst[col * erg.column_stride] *= beta;
+
+        T const* a = lhs.data + static_cast<std::size_t>(row) * lhs.row_stride;
+        for (index_t k = 0; k < depth; k++)
+        {
+          T const  fac = alpha * a[k * lhs.column_stride];
+          T const* src = rhs.data + static_cast<std::size_t>(k) * rhs.row_stride;
+          for (index_t col = 0; col < columns; col++)
+            dst[col * erg.column_stride] += fac * src[col * rhs.column_stride];
+        }
+      }
+    }
+
+    template <typename T> EXMATH_KERNEL_INLINE void lu_solve(index_t n, index_t columns, strided_ref_t<T> mat, strided_ref_t<T> b) noexcept
+    {
+      auto row_of = [](strided_ref_t<T> const& ref, index_t row) { return ref.data + static_cast<std::size_t>(row) * ref.row_stride; };
+
+      for (index_t col = 0; col < n; col++)
+      {
+        index_t sel_idx = col;
+        for (index_t idx = col + 1; idx < n; idx++)
+          if (N::Internal::abs(row_of(mat, sel_idx)[col]) < N::Internal::abs(row_of(mat, idx)[col]))
+            sel_idx = idx;
+
+        if (sel_idx != col)
+        {
+          std::swap_ranges(row_of(mat, col), row_of(mat, col) + n, row_of(mat, sel_idx));
+          std::swap_ranges(row_of(b, col), row_of(b, col) + columns, row_of(b, sel_idx));
+        }
+
+        T const* src   = row_of(mat, col);
+        T const* src_b = row_of(b, col);
+        for (index_t idx = col + 1; idx < n; idx++)
+        {
+          T*      dst   = row_of(mat, idx);
+          T*      dst_b = row_of(b, idx);
+          T const fac   = dst[col] / src[col];
+
+          dst[col] = fac;
+          for (index_t c = col + 1; c < n; c++)
+            dst[c] -= fac * src[c];
+          for (index_t c = 0; c < columns; c++)
+            dst_b[c] -= fac * src_b[c];
+        }
+      }
+
+      for (index_t row = n; row-- > 0;)
+      {
+        T*       dst = row_of(b, row);
+        T const* lu  = row_of(mat, row);
+        for (index_t idx = row + 1; idx < n; idx++)
+        {
+          T const  fac = lu[idx];
+          T const* src = row_of(b, idx);
+          for (index_t col = 0; col < columns; col++)
+            dst[col] -= fac * src[col];
+        }
+
+        T const fac = lu[row];
+        for (index_t col = 0; col < columns; col++)
+          dst[col] /= fac;
+      }
+    }
+
+    template <typename T> EXMATH_KERNEL_INLINE bool lu_factor(index_t n, strided_ref_t<T> mat, index_t* perm, bool& odd_permutation) noexcept
+    {
+      auto row_of = [&](index_t row) { return mat.data + static_cast<std::size_t>(row) * mat.row_stride; };
+
+      bool singular = false;
+      for (index_t idx = 0; idx < n; idx++)
+        perm[idx] = idx;
+
+      for (index_t col = 0; col < n; col++)
+      {
+        index_t sel_idx = col;
+        for (index_t idx = col + 1; idx < n; idx++)
+          if (N::Internal::abs(row_of(perm[sel_idx])[col]) < N::Internal::abs(row_of(perm[idx])[col]))
+            sel_idx = idx;
+
+        if (sel_idx != col)
+        {
+          std::swap(perm[sel_idx], perm[col]);
+          odd_permutation = !odd_permutation;
+        }
+
+        T const* src   = row_of(perm[col]);
+        T const  pivot = src[col];
+        if (pivot == T{ 0 })
+        {
+          singular = true;
+          continue;
+        }
+
+        for (index_t idx = col + 1; idx < n; idx++)
+        {
+          T*      dst = row_of(perm[idx]);
+          T const fac = dst[col] / pivot;
+
+          dst[col] = fac;
+          for (index_t c = col + 1; c < n; c++)
+            dst[c] -= fac * src[c];
+        }
+      }
+      return singular;
+    }
+
+    template <typename T>
+    EXMATH_KERNEL_INLINE void lu_substitute(index_t n, index_t columns, strided_ref_t<T const> lu, index_t const* perm, strided_ref_t<T> erg) noexcept
+    {
+      auto lu_row  = [&](index_t row) { return lu.data + static_cast<std::size_t>(perm[row]) * lu.row_stride; };
+      auto erg_row = [&](index_t row) { return erg.data + static_cast<std::size_t>(row) * erg.row_stride; };
+
+      for (index_t row = 1; row < n; row++)
+      {
+        T*       dst   = erg_row(row);
+        T const* lower = lu_row(row);
+        for (index_t idx = 0; idx < row; idx++)
+        {
+          T const  fac = lower[idx];
+          T const* src = erg_row(idx);
+          for (index_t col = 0; col < columns; col++)
+            dst[col] -= fac * src[col];
+        }
+      }
+
+      for (index_t row = n; row-- > 0;)
+      {
+        T*       dst   = erg_row(row);
+        T const* upper = lu_row(row);
+        for (index_t idx = row + 1; idx < n; idx++)
+        {
+          T const  fac = upper[idx];
+          T const* src = erg_row(idx);
+          for (index_t col = 0; col < columns; col++)
+            dst[col] -= fac * src[col];
+        }
+
+        T const fac = upper[row];
+        for (index_t col = 0; col < columns; col++)
+          dst[col] /= fac;
+      }
+    }
+
+    template <typename T>
+    EXMATH_KERNEL_INLINE void batch_mult(index_t rows, index_t inner, index_t columns, index_t batch, T const* lhs, T const* rhs, T* erg) noexcept
+    {
+      for (index_t row = 0; row < rows; row++)
+        for (index_t k = 0; k < inner; k++)
+        {
+          T const* a = lhs + (static_cast<std::size_t>(row) * inner + k) * batch;
+          for (index_t col = 0; col < columns; col++)
+          {
+            T*       dst = erg + (static_cast<std::size_t>(row) * columns + col) * batch;
+            T const* b   = rhs + (static_cast<std::size_t>(k) * columns + col) * batch;
+            if (k == 0)
+              for (index_t lane = 0; lane < batch; lane++)
+                dst[lane] = a[lane] * b[lane];
+            else
+              for (index_t lane = 0; lane < batch; lane++)
+                dst[lane] += a[lane] * b[lane];
+          }
+        }
+    }
+
+    // see Internal::batch_solve; lanes are processed in chunks so the per-lane scratch fits on the stack
+    template <typename T> EXMATH_KERNEL_INLINE void batch_solve(index_t n, index_t columns, index_t batch, T* mat, T* erg) noexcept
+    {
+      constexpr index_t chunk = 64;
+
+      T mask[chunk];
+      T fac[chunk];
+
+      for (index_t first = 0; first < batch; first += chunk)
+      {
+        index_t const width = batch - first < chunk ? batch - first : chunk;
+
+        auto val_lanes = [&](index_t row, index_t col) { return mat + (static_cast<std::size_t>(row) * n + col) * batch + first; };
+        auto erg_lanes = [&](index_t row, index_t col) { return erg + (static_cast<std::size_t>(row) * columns + col) * batch + first; };
+
+        for (index_t row = 0; row < n; row++)
+        {
+          for (index_t idx = row + 1; idx < n; idx++)
+          {
+            T const* cand  = val_lanes(idx, row);
+            T const* pivot = val_lanes(row, row);
+            for (index_t lane = 0; lane < width; lane++)
+              mask[lane] = N::Internal::abs(pivot[lane]) < N::Internal::abs(cand[lane]) ? T{ 1 } : T{ 0 };
+
+            for (index_t col = 0; col < n + columns; col++)
+            {
+              if (col < n && col < row)
+                continue;
+              T* lhs = col < n ? val_lanes(row, col) : erg_lanes(row, col - n);
+              T* rhs = col < n ? val_lanes(idx, col) : erg_lanes(idx, col - n);
+              for (index_t lane = 0; lane < width; lane++)
+              {
+                T const    l   = lhs[lane];
+                T const    r   = rhs[lane];
+                bool const sel = mask[lane] != T{ 0 };
+                lhs[lane]      = sel ? r : l;
+                rhs[lane]      = sel ? l : r;
+              }
+            }
+          }
+
+          T const* pivot = val_lanes(row, row);
+          for (index_t lane = 0; lane < width; lane++)
+            fac[lane] = T{ 1 } / pivot[lane];
+
+          for (index_t col = row; col < n + columns; col++)
+          {
+            T* dst = col < n ? val_lanes(row, col) : erg_lanes(row, col - n);
+            for (index_t lane = 0; lane < width; lane++)
+              dst[lane] *= fac[lane];
+          }
+
+          for (index_t idx = 0; idx < n; idx++)
+          {
+            if (idx == row)
+              continue;
+
+            T const* src = val_lanes(idx, row);
+            for (index_t lane = 0; lane < width; lane++)
+              fac[lane] = src[lane];
+
+            for (index_t col = row; col < n + columns; col++)
+            {
+              T*       dst = col < n ? val_lanes(idx, col) : erg_lanes(idx, col - n);
+              T const* top = col < n ? val_lanes(row, col) : erg_lanes(row, col - n);
+              for (index_t lane = 0; lane < width; lane++)
+                dst[lane] -= fac[lane] * top[lane];
+            }
+          }
+        }
+      }
+    }
+  }    // namespace kernels
+
+  template <typename T> struct kernel_set_t
+  {
+    void (*add)(T*, T const*, T const*, std::size_t) noexcept;
+    void (*sub)(T*, T const*, T const*, std::size_t) noexcept;
+    void (*gemm)(index_t, index_t, index_t, T, strided_ref_t<T const>, strided_ref_t<T const>, T, strided_ref_t<T>) noexcept;
+    void (*lu_solve)(index_t, index_t, strided_ref_t<T>, strided_ref_t<T>) noexcept;
+    bool (*lu_factor)(index_t, strided_ref_t<T>, index_t*, bool&) noexcept;
+    void (*lu_substitute)(index_t, index_t, strided_ref_t<T const>, index_t const*, strided_ref_t<T>) noexcept;
+    void (*batch_mult)(index_t, index_t, index_t, index_t, T const*, T const*, T*) noexcept;
+    void (*batch_solve)(index_t, index_t, index_t, T*, T*) noexcept;
+  };
+
+  struct kernel_table_t
+  {
+    N::isa_t             isa;
+    kernel_set_t<float>  f;
+    kernel_set_t<double> d;
+  };
+
+#define EXMATH_KERNEL_VARIANT(name, target)                                                                                                                \
+  namespace name                                                                                                                                           \
+  {                                                                                                                                                        \
+    template <typename T> target void add(T* erg, T const* lhs, T const* rhs, std::size_t count) noexcept { kernels::add(erg, lhs, rhs, count); }         \
+    template <typename T> target void sub(T* erg, T const* lhs, T const* rhs, std::size_t count) noexcept { kernels::sub(erg, lhs, rhs, count); }         \
+    template <typename T>                                                                                                                                  \
+    target void gemm(index_t rows, index_t columns, index_t depth, T alpha, strided_ref_t<T const> lhs, strided_ref_t<T const> rhs, T beta,              \
+                     strided_ref_t<T> erg) noexcept                                                                                                        \
+    {                                                                                                                                                      \
+      kernels::gemm(rows, columns, depth, alpha, lhs, rhs, beta, erg);                                                                                     \
+    }                                                                                                                                                      \
+    template <typename T> target void lu_solve(index_t n, index_t columns, strided_ref_t<T> mat, strided_ref_t<T> b) noexcept                             \
+    {                                                                                                                                                      \
+      kernels::lu_solve(n, columns, mat, b);                                                                                                               \
+    }                                                                                                                                                      \
+    template <typename T> target bool lu_factor(index_t n, strided_ref_t<T> mat, index_t* perm, bool& odd_permutation) noexcept                            \
+    {                                                                                                                                                      \
+      return kernels::lu_factor(n, mat, perm, odd_permutation);                                                                                            \
+    }                                                                                                                                                      \
+    template <typename T>                                                                                                                                  \
+    target void lu_substitute(index_t n, index_t columns, strided_ref_t<T const> lu, index_t const* perm, strided_ref_t<T> erg) noexcept                   \
+    {                                                                                                                                                      \
+      kernels::lu_substitute(n, columns, lu, perm, erg);                                                                                                   \
+    }                                                                                                                                                      \
+    template <typename T>                                                                                                                                  \
+    target void batch_mult(index_t rows, index_t inner, index_t columns, index_t batch, T const* lhs, T const* rhs, T* erg) noexcept                      \
+    {                                                                                                                                                      \
+      kernels::batch_mult(rows, inner, columns, batch, lhs, rhs, erg);                                                                                     \
+    }                                                                                                                                                      \
+    template <typename T> target void batch_solve(index_t n, index_t columns, index_t batch, T* mat, T* erg) noexcept                                     \
+    {                                                                                                                                                      \
+      kernels::batch_solve(n, columns, batch, mat, erg);                                                                                                   \
+    }                                                                                                                                                      \
+    template <typename T>                                                                                                                                  \
+    constexpr kernel_set_t<T> set{ &add<T>, &sub<T>, &gemm<T>, &lu_solve<T>, &lu_factor<T>, &lu_substitute<T>, &batch_mult<T>, &batch_solve<T> };          \
+  }
+
+  EXMATH_KERNEL_VARIANT(baseline, )
+  constexpr kernel_table_t baseline_table{ N::isa_t::baseline, baseline::set<float>, baseline::set<double> };
+
+#if EXMATH_RUNTIME_DISPATCH
+  EXMATH_KERNEL_VARIANT(avx2, EXMATH_TARGET_AVX2)
+  EXMATH_KERNEL_VARIANT(avx512, EXMATH_TARGET_AVX512)
+  constexpr kernel_table_t avx2_table{ N::isa_t::avx2, avx2::set<float>, avx2::set<double> };
+  constexpr kernel_table_t avx512_table{ N::isa_t::avx512, avx512::set<float>, avx512::set<double> };
+#endif
+
+#undef EXMATH_KERNEL_VARIANT
+
+  bool is_supported(N::isa_t isa) noexcept
+  {
+    switch (isa)
+    {
+    case N::isa_t::baseline:
+      return true;
+#if EXMATH_RUNTIME_DISPATCH
+    case N::isa_t::avx2:
+      return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    case N::isa_t::avx512:
+      return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+    default:
+      return false;
+    }
+  }
+
+  kernel_table_t const* table_for(N::isa_t isa) noexcept
+  {
+    switch (isa)
+    {
+#if EXMATH_RUNTIME_DISPATCH
+    case N::isa_t::avx2:
+      return &avx2_table;
+    case N::isa_t::avx512:
+      return &avx512_table;
+#endif
+    default:
+      return &baseline_table;
+    }
+  }
+
+  // initialized on first use, so kernels called from other static initializers already see the detected variant
+  std::atomic<kernel_table_t const*>& selected_table() noexcept
+  {
+    static std::atomic<kernel_table_t const*> table{ table_for(N::detected_isa()) };
+    return table;
+  }
+
+  template <typename T> kernel_set_t<T> const& kernels_for() noexcept
+  {
+    kernel_table_t const* table = selected_table().load(std::memory_order_relaxed);
+    if constexpr (std::is_same_v<T, float>)
+      return table->f;
+    else
+      return table->d;
+  }
+}    // namespace
+
+namespace ExMath
+{
+  auto detected_isa() noexcept -> isa_t
+  {
+    static isa_t const isa = is_supported(isa_t::avx512) ? isa_t::avx512 : is_supported(isa_t::avx2) ? isa_t::avx2 : isa_t::baseline;
+    return isa;
+  }
+
+  auto selected_isa() noexcept -> isa_t { return selected_table().load(std::memory_order_relaxed)->isa; }
+
+  bool select_isa(isa_t isa) noexcept
+  {
+    if (!is_supported(isa))
+      return false;
+    selected_table().store(table_for(isa), std::memory_order_relaxed);
+    return true;
+  }
+
+  auto isa_name(isa_t isa) noexcept -> char const*
+  {
+    switch (isa)
+    {
+    case isa_t::avx2:
+      return "avx2";
+    case isa_t::avx512:
+      return "avx512";
+    default:
+      return "baseline";
+    }
+  }
+
+  namespace Internal
+  {
+    void runtime_add(float* erg, float const* lhs, float const* rhs, std::size_t count) noexcept { kernels_for<float>().add(erg, lhs, rhs, count); }
+    void runtime_add(double* erg, double const* lhs, double const* rhs, std::size_t count) noexcept { kernels_for<double>().add(erg, lhs, rhs, count); }
+    void runtime_sub(float* erg, float const* lhs, float const* rhs, std::size_t count) noexcept { kernels_for<float>().sub(erg, lhs, rhs, count); }
+    void runtime_sub(double* erg, double const* lhs, double const* rhs, std::size_t count) noexcept { kernels_for<double>().sub(erg, lhs, rhs, count); }
+
+    void runtime_gemm(index_t rows, index_t columns, index_t depth, float alpha, strided_ref_t<float const> lhs, strided_ref_t<float const> rhs, float beta,
+                      strided_ref_t<float> erg) noexcept
+    {
+      kernels_for<float>().gemm(rows, columns, depth, alpha, lhs, rhs, beta, erg);
+    }
+
+    void runtime_gemm(index_t rows, index_t columns, index_t depth, double alpha, strided_ref_t<double const> lhs, strided_ref_t<double const> rhs,
+                      double beta, strided_ref_t<double> erg) noexcept
+    {
+      kernels_for<double>().gemm(rows, columns, depth, alpha, lhs, rhs, beta, erg);
+    }
+
+    void runtime_lu_solve(index_t n, index_t columns, strided_ref_t<float> mat, strided_ref_t<float> b) noexcept
+    {
+      kernels_for<float>().lu_solve(n, columns, mat, b);
+    }
+
+    void runtime_lu_solve(index_t n, index_t columns, strided_ref_t<double> mat, strided_ref_t<double> b) noexcept
+    {
+      kernels_for<double>().lu_solve(n, columns, mat, b);
+    }
+
+    bool runtime_lu_factor(index_t n, strided_ref_t<float> mat, index_t* perm, bool& odd_permutation) noexcept
+    {
+      return kernels_for<float>().lu_factor(n, mat, perm, odd_permutation);
+    }
+
+    bool runtime_lu_factor(index_t n, strided_ref_t<double> mat, index_t* perm, bool& odd_permutation) noexcept
+    {
+      return kernels_for<double>().lu_factor(n, mat, perm, odd_permutation);
+    }
+
+    void runtime_lu_substitute(index_t n, index_t columns, strided_ref_t<float const> lu, index_t const* perm, strided_ref_t<float> erg) noexcept
+    {
+      kernels_for<float>().lu_substitute(n, columns, lu, perm, erg);
+    }
+
+    void runtime_lu_substitute(index_t n, index_t columns, strided_ref_t<double const> lu, index_t const* perm, strided_ref_t<double> erg) noexcept
+    {
+      kernels_for<double>().lu_substitute(n, columns, lu, perm, erg);
+    }
+
+    void runtime_batch_mult(index_t rows, index_t inner, index_t columns, index_t batch, float const* lhs, float const* rhs, float* erg) noexcept
+    {
+      kernels_for<float>().batch_mult(rows, inner, columns, batch, lhs, rhs, erg);
+    }
+
+    void runtime_batch_mult(index_t rows, index_t inner, index_t columns, index_t batch, double const* lhs, double const* rhs, double* erg) noexcept
+    {
+      kernels_for<double>().batch_mult(rows, inner, columns, batch, lhs, rhs, erg);
+    }
+
+    void runtime_batch_solve(index_t n, index_t columns, index_t batch, float* mat, float* erg) noexcept
+    {
+      kernels_for<float>().batch_solve(n, columns, batch, mat, erg);
+    }
+
+    void runtime_batch_solve(index_t n, index_t columns, index_t batch, double* mat, double* erg) noexcept
+    {
+      kernels_for<double>().batch_solve(n, columns, batch, mat, erg);
+    }
+  }    // namespace Internal
+}    // namespace ExMath
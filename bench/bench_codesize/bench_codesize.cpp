@@ -0,0 +1,34 @@
+#include <ExMath.hpp>
+#include <tuple>
+#include <utility>
+
+// instantiates the add, mult and solve kernels for a range of sizes the way an application with many matrix shapes does;
+// report_codesize.cmake compares the text size of this file built with and without the runtime kernels
+
+namespace
+{
+  namespace N = ExMath;
+
+  template <N::index_t size, typename T>
+  void kernels(N::static_matrix_t<size, size, T>& a,
+               N::static_matrix_t<size, size, T>& b,
+               N::static_matrix_t<size, size, T>& c,
+               N::static_matrix_t<size, 2, T>&    x)
+  {
+    N::Internal::add(c, a, b);
+    N::Internal::sub(c, c, b);
+    N::Internal::add_assign(c, a);
+    N::Internal::mult(b, a, c);
+    N::Internal::mult(c, N::transpose(a), b);
+    x = N::solve(a, x);
+  }
+
+  template <typename T, N::index_t... offsets> constexpr auto kernel_table(std::integer_sequence<N::index_t, offsets...>)
+  {
+    return std::make_tuple(&kernels<offsets + 12, T>...);
+  }
+}    // namespace
+
+// external linkage keeps every instantiation in the object file
+auto exmath_codesize_float  = kernel_table<float>(std::make_integer_sequence<N::index_t, 40>{});
+auto exmath_codesize_double = kernel_table<double>(std::make_integer_sequence<N::index_t, 40>{});
@@ -0,0 +1,27 @@
+# prints the summed size of the text sections of both builds of bench_codesize.cpp
+
+function(text_size object result)
+	execute_process(COMMAND ${OBJDUMP} -h ${object} OUTPUT_VARIABLE headers RESULT_VARIABLE failed)
+	if(failed)
+		message(FATAL_ERROR "${OBJDUMP} failed on ${object}")
+	endif()
+
+	string(REPLACE "\n" ";" lines "${headers}")
+	set(total 0)
+	foreach(line IN LISTS lines)
+		if(line MATCHES "^ +[0-9]+ \\.text[^ ]* +([0-9a-f]+) ")
+			math(EXPR total "${total} + 0x${CMAKE_MATCH_1}")
+		endif()
+	endforeach()
+	set(${result} ${total} PARENT_SCOPE)
+endfunction()
+
+text_size(${TEMPLATED} templated)
+text_size(${RUNTIME} runtime)
+math(EXPR saved "${templated} - ${runtime}")
+math(EXPR percent "100 * ${saved} / ${templated}")
+
+message("text size of add, sub, mult and solve for 40 sizes x float / double")
+message("  templated kernels only : ${templated} bytes")
+message("  runtime kernels        : ${runtime} bytes")
+message("  saved                  : ${saved} bytes (${percent} %)")
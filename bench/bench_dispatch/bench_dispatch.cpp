@@ -0,0 +1,77 @@
+#include <ExMath.hpp>
+#include <chrono>
+#include <cstdio>
+
+namespace
+{
+  namespace N = ExMath;
+
+  volatile double g_zero = 0;
+  volatile double g_sink = 0;
+
+  template <typename Fnc> double measure_ns(Fnc&& fnc)
+  {
+    using clock_t = std::chrono::steady_clock;
+
+    long iterations = 4;
+    while (true)
+    {
+      auto const start = clock_t::now();
+      for (long idx = 0; idx < iterations; idx++)
+        g_sink = g_sink + fnc();
+      auto const elapsed = std::chrono::duration<double, std::nano>(clock_t::now() - start).count();
+
+      if (elapsed > 5.0e7)
+        return elapsed / static_cast<double>(iterations);
+      iterations *= 2;
+    }
+  }
+
+  void run(N::isa_t isa)
+  {
+    constexpr N::index_t size  = 256;
+    constexpr N::index_t batch = 1024;
+    constexpr N::index_t fixed = 64;
+
+    using D = N::dynamic_matrix_t<double>;
+    using B = N::static_matrix_batch_t<6, 6, double, batch>;
+    using S = N::static_matrix_t<fixed, fixed, double>;
+    using X = N::static_matrix_t<fixed, 4, double>;
+
+    D const a{ size, size, [](N::index_t const& r, N::index_t const& c) { return static_cast<double>((r * 7 + c * 3) % 11) / 11.0 - 0.5; } };
+    D const m = a + D{ size, size, [](N::index_t const& r, N::index_t const& c) { return r == c ? 4.0 : 0.0; } };
+
+    auto* const b = new B;
+    for (N::index_t lane = 0; lane < batch; lane++)
+    {
+      auto fm = [=](N::index_t const& r, N::index_t const& c) { return r == c ? 3.0 : static_cast<double>((r + c + lane) % 5) / 5.0; };
+      b->set(lane, N::static_matrix_t<6, 6, double>{ fm });
+    }
+
+    // static sizes at or above EXMATH_RUNTIME_KERNEL_MIN_ELEMENTS factor through the same kernels
+    S const s = [](N::index_t const& r, N::index_t const& c) { return r == c ? 4.0 : static_cast<double>((r * 7 + c * 3) % 11) / 11.0 - 0.5; };
+    X const x = [](N::index_t const& r, N::index_t const& c) { return static_cast<double>((r + 2 * c) % 5) - 2.0; };
+
+    double const t_gemm   = measure_ns([&]() { return (a * a)(0, 0) + g_zero; });
+    double const t_solve  = measure_ns([&]() { return N::solve(m, a)(0, 0) + g_zero; });
+    double const t_add    = measure_ns([&]() { return (a + a)(0, 0) + g_zero; });
+    double const t_batch  = measure_ns([&]() { return N::solve(*b, *b)(0, 0, 0) + g_zero; });
+    double const t_static = measure_ns([&]() { return N::solve(s, x)(0, 0) + g_zero; });
+    delete b;
+
+    std::printf("%-9s %12.0f %12.0f %12.0f %12.0f %12.1f\n", N::isa_name(isa), t_gemm / 1e3, t_solve / 1e3, t_add / 1e3, t_batch / 1e3, t_static / 1e3);
+  }
+}    // namespace
+
+int main()
+{
+  std::printf("runtime kernels per instruction set variant, detected: %s [us]\n", N::isa_name(N::detected_isa()));
+  std::printf("%-9s %12s %12s %12s %12s %12s\n", "isa", "gemm 256", "solve 256", "add 256", "batch 6x6", "static 64");
+
+  N::isa_t const detected = N::detected_isa();
+  for (N::isa_t isa : { N::isa_t::baseline, N::isa_t::avx2, N::isa_t::avx512 })
+    if (N::select_isa(isa))
+      run(isa);
+  N::select_isa(detected);
+  return 0;
+}
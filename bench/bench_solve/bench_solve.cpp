@@ -0,0 +1,79 @@
+#include <ExMath.hpp>
+#include <chrono>
+#include <cstdio>
+#include <utility>
+
+namespace
+{
+  namespace N = ExMath;
+
+  using value_type = double;
+
+  // reading g_zero inside the timing loops keeps the compiler from hoisting the work out of them
+  volatile value_type g_zero = 0;
+  volatile value_type g_sink = 0;
+
+  template <N::index_t size> auto make_spd_matrix()
+  {
+    using mat_t = N::static_matrix_t<size, size, value_type>;
+
+    mat_t b = [](N::index_t const& r, N::index_t const& c) { return static_cast<value_type>((r * 7 + c * 3) % 11) / 11 - 0.5; };
+    mat_t m = b * N::transpose(b) + N::identity_matrix_t<size, size, value_type>() * static_cast<value_type>(size);
+    return m;
+  }
+
+  template <typename Fnc> double measure_ns(Fnc&& fnc)
+  {
+    using clock_t = std::chrono::steady_clock;
+
+    long iterations = 16;
+    while (true)
+    {
+      auto const start = clock_t::now();
+      for (long idx = 0; idx < iterations; idx++)
+        g_sink = g_sink + fnc();
+      auto const elapsed = std::chrono::duration<double, std::nano>(clock_t::now() - start).count();
+
+      if (elapsed > 2.0e7)
+        return elapsed / static_cast<double>(iterations);
+      iterations *= 2;
+    }
+  }
+
+  template <N::index_t size> void run()
+  {
+    auto const m = make_spd_matrix<size>();
+    auto const b = N::static_matrix_t<size, 1, value_type>{ [](N::index_t const& r, N::index_t const&) { return static_cast<value_type>(r + 1); } };
+
+    auto const perturbed = [&]()
+    {
+      auto a = m;
+      a(0, 0) += g_zero;
+      return a;
+    };
+
+    double const t_gauss = measure_ns(
+        [&]()
+        {
+          auto a = perturbed();
+          auto x = b;
+          N::Internal::solve(a, x);
+          return x(0, 0);
+        });
+    double const t_lu   = measure_ns([&]() { return N::lu_factorization_t{ perturbed() }.solve(b)(0, 0); });
+    double const t_llt  = measure_ns([&]() { return N::cholesky_t{ perturbed() }.solve(b)(0, 0); });
+    double const t_ldlt = measure_ns([&]() { return N::ldlt_t{ perturbed() }.solve(b)(0, 0); });
+
+    std::printf("%4u %12.1f %12.1f %12.1f %12.1f\n", static_cast<unsigned>(size), t_gauss, t_lu, t_llt, t_ldlt);
+  }
+
+  template <N::index_t... offsets> void run_all(std::integer_sequence<N::index_t, offsets...>) { (run<offsets + 3>(), ...); }
+}    // namespace
+
+int main()
+{
+  std::printf("factor + solve of a symmetric positive definite N x N system with one right-hand side [ns]\n");
+  std::printf("%4s %12s %12s %12s %12s\n", "N", "gauss-jordan", "lu", "llt", "ldlt");
+  run_all(std::make_integer_sequence<N::index_t, 30>{});
+  return 0;
+}
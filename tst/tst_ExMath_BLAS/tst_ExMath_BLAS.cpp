@@ -1,8 +1,21 @@
 #include <ExMath.hpp>
+#include <functional>
 #include <ut_catch.hpp>
 
 namespace N = ExMath;
 
+namespace
+{
+  // fill patterns of small integers, so that sums of their products are exact in every value type
+  template <typename T>
+  constexpr auto pattern_a = [](N::index_t const& r, N::index_t const& c) { return static_cast<T>((r * 7 + c * 3) % 11) - static_cast<T>(5); };
+  template <typename T>
+  constexpr auto pattern_b = [](N::index_t const& r, N::index_t const& c) { return static_cast<T>((r * 5 + c * 2) % 13) - static_cast<T>(6); };
+
+  // right hand sides
+  constexpr auto ramp = [](N::index_t const& r, N::index_t const& c) { return static_cast<double>(r) - static_cast<double>(c) * 0.5; };
+}    // namespace
+
 TEST_CASE()
 {
   using T = N::identity_matrix_t<1, 1, float>;
@@ -344,3 +357,1232 @@ TEST_CASE()
       REQUIRE(N::transpose(eT)(row, col) == Approx(x(row, col)));
     }
 }
+
+TEST_CASE()
+{
+  using T1 = N::static_matrix_t<3, 2, int>;
+  using T2 = N::static_matrix_t<2, 3, int>;
+
+  static_assert(N::contiguous_static_matrix_concept<T1>);
+  static_assert(N::contiguous_static_matrix_concept<N::matrix_view_t<3, 2, int>>);
+  static_assert(N::contiguous_static_matrix_concept<N::static_matrix_external_memory_t<3, 2, int>>);
+  static_assert(N::contiguous_static_matrix_concept<N::transpose_view_t<T2>>);
+  static_assert(!N::contiguous_static_matrix_concept<N::identity_matrix_t<3, 3, int>>);
+  static_assert(!N::contiguous_static_matrix_concept<N::transpose_view_t<N::identity_matrix_t<3, 3, int>>>);
+
+  static_assert(N::same_contiguous_layout<T1, N::matrix_view_t<3, 2, int>>);
+  static_assert(!N::same_contiguous_layout<T1, N::transpose_view_t<T2>>);
+
+  T1 t1 = { 1, 2, 3, 4, 5, 6 };
+  T1 t2 = { 6, 5, 4, 3, 2, 1 };
+  T2 t3 = { 1, 3, 5, 2, 4, 6 };
+
+  T1 e1 = t1 + t2;
+  T1 e2 = t1 - N::transpose(t3);
+  T1 e3 = t1 * 3;
+
+  e3 -= t2;
+  e3 += N::transpose(t3);
+
+  for (N::index_t row = 0; row < T1::number_of_rows; row++)
+    for (N::index_t col = 0; col < T1::number_of_columns; col++)
+    {
+      REQUIRE(e1(row, col) == 7);
+      REQUIRE(e2(row, col) == 0);
+      REQUIRE(e3(row, col) == 3 * t1(row, col) - t2(row, col) + t3(col, row));
+    }
+}
+
+TEST_CASE()
+{
+  using TR = N::static_matrix_t<2, 3, int>;
+  using TC = N::static_matrix_t<2, 3, int, N::storage_order_t::column_major>;
+  using TE = N::static_matrix_external_memory_t<2, 3, int, N::storage_order_t::column_major>;
+
+  static_assert(TC::storage_order == N::storage_order_t::column_major);
+  static_assert(N::transpose_view_t<TC>::storage_order == N::storage_order_t::row_major);
+  static_assert(N::same_contiguous_layout<N::transpose_view_t<TC>, N::static_matrix_t<3, 2, int>>);
+  static_assert(N::same_contiguous_layout<TC, TE>);
+
+  TR tr = { 1, 2, 3, 4, 5, 6 };
+  TC tc = { 1, 4, 2, 5, 3, 6 };
+
+  int data[6] = { 0, 0, 0, 0, 0, 0 };
+  TE  te{ data };
+  te = tr;
+
+  REQUIRE(data[0] == 1);
+  REQUIRE(data[1] == 4);
+  REQUIRE(data[2] == 2);
+  REQUIRE(data[5] == 6);
+
+  auto e1 = tr + tc;
+  auto e2 = tc + tr;
+  auto e3 = tc * N::transpose(tr);
+  auto e4 = tc - te;
+
+  static_assert(decltype(e1)::storage_order == N::storage_order_t::row_major);
+  static_assert(decltype(e2)::storage_order == N::storage_order_t::column_major);
+
+  for (N::index_t row = 0; row < TR::number_of_rows; row++)
+    for (N::index_t col = 0; col < TR::number_of_columns; col++)
+    {
+      REQUIRE(tc(row, col) == tr(row, col));
+      REQUIRE(e1(row, col) == 2 * tr(row, col));
+      REQUIRE(e2(row, col) == 2 * tr(row, col));
+      REQUIRE(e4(row, col) == 0);
+    }
+
+  REQUIRE(e3(0, 0) == 14);
+  REQUIRE(e3(0, 1) == 32);
+  REQUIRE(e3(1, 0) == 32);
+  REQUIRE(e3(1, 1) == 77);
+
+  N::static_matrix_t<3, 2, int, N::storage_order_t::row_major> tt = N::transpose(tc);
+  for (N::index_t idx = 0; idx < TC::number_of_elements; idx++)
+    REQUIRE(tt.data()[idx] == tc.data()[idx]);
+}
+
+TEST_CASE()
+{
+  using T1 = N::static_matrix_t<2, 2, int>;
+  using T2 = N::static_matrix_t<2, 3, int>;
+  using I2 = N::identity_matrix_t<2, 2, int>;
+
+  static_assert(std::is_invocable_v<std::plus<>, T1 const&, I2>);
+  static_assert(!std::is_invocable_v<std::plus<>, T1 const&, T2 const&>);
+  static_assert(!std::is_invocable_v<std::minus<>, T2 const&, T1 const&>);
+
+  T1 m = { 1, 2, 3, 4 };
+
+  auto expr = m + m - I2() + m * 2;
+
+  static_assert(N::lazy_expression_concept<decltype(expr)>);
+  static_assert(N::readable_static_matrix_concept<decltype(expr)>);
+  static_assert(!N::writeable_static_matrix_concept<decltype(expr)>);
+
+  T1 e1 = expr;
+  REQUIRE(e1(0, 0) == 3);
+  REQUIRE(e1(0, 1) == 8);
+  REQUIRE(e1(1, 0) == 12);
+  REQUIRE(e1(1, 1) == 15);
+
+  T1 e2 = (m + I2()) * (m - I2());
+  REQUIRE(e2(0, 0) == 6);
+  REQUIRE(e2(0, 1) == 10);
+  REQUIRE(e2(1, 0) == 15);
+  REQUIRE(e2(1, 1) == 21);
+
+  m = m + N::transpose(m);
+  REQUIRE(m(0, 0) == 2);
+  REQUIRE(m(0, 1) == 5);
+  REQUIRE(m(1, 0) == 5);
+  REQUIRE(m(1, 1) == 8);
+
+  m = { 1, 2, 3, 4 };
+  m -= N::transpose(m) * 2;
+  REQUIRE(m(0, 0) == -1);
+  REQUIRE(m(0, 1) == -4);
+  REQUIRE(m(1, 0) == -1);
+  REQUIRE(m(1, 1) == -4);
+}
+
+namespace
+{
+  template <typename Erg, typename Lhs, typename Rhs> void check_blocked_mult()
+  {
+    Lhs lhs = pattern_a<typename Lhs::value_type>;
+    Rhs rhs = pattern_b<typename Rhs::value_type>;
+
+    Erg erg;
+    Erg ref;
+    N::Internal::gemm_blocked(erg, 1, lhs, rhs, 0);
+    N::Internal::gemm_reference(ref, 1, lhs, rhs, 0);
+
+    for (N::index_t row = 0; row < Erg::number_of_rows; row++)
+      for (N::index_t col = 0; col < Erg::number_of_columns; col++)
+        REQUIRE(erg(row, col) == ref(row, col));
+  }
+}    // namespace
+
+TEST_CASE()
+{
+  constexpr auto R = N::storage_order_t::row_major;
+  constexpr auto C = N::storage_order_t::column_major;
+
+  check_blocked_mult<N::static_matrix_t<4, 4, double>, N::static_matrix_t<4, 4, double>, N::static_matrix_t<4, 4, double>>();
+  check_blocked_mult<N::static_matrix_t<9, 11, float>, N::static_matrix_t<9, 5, float>, N::static_matrix_t<5, 11, float>>();
+  check_blocked_mult<N::static_matrix_t<18, 18, double, C>, N::static_matrix_t<18, 18, double, R>, N::static_matrix_t<18, 18, double, C>>();
+  check_blocked_mult<N::static_matrix_t<7, 3, float, R>, N::static_matrix_t<7, 13, float, C>, N::static_matrix_t<13, 3, float, C>>();
+  check_blocked_mult<N::static_matrix_t<1, 6, double>, N::static_matrix_t<1, 2, double>, N::static_matrix_t<2, 6, double>>();
+  check_blocked_mult<N::static_matrix_t<33, 17, float, C>, N::static_matrix_t<33, 40, float, R>, N::static_matrix_t<40, 17, float, R>>();
+
+  static_assert(N::Internal::gemm_tiled_concept<N::static_matrix_t<18, 18, double>>);
+  static_assert(!N::Internal::gemm_tiled_concept<N::static_matrix_t<4, 4, double>>);
+  static_assert(!N::Internal::gemm_tiled_concept<N::static_matrix_t<32, 32, int>>);
+
+  N::static_matrix_t<3, 2, double> a = { 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 };
+  N::static_matrix_t<2, 2, double> e = N::transpose(a) * a;
+  REQUIRE(e(0, 0) == 35.0);
+  REQUIRE(e(0, 1) == 44.0);
+  REQUIRE(e(1, 0) == 44.0);
+  REQUIRE(e(1, 1) == 56.0);
+}
+
+TEST_CASE()
+{
+  using T1 = N::static_matrix_t<3, 3, double>;
+  using T2 = N::static_matrix_t<3, 2, double>;
+
+  T1 a = { 1.0, 2.0, 0.0, -1.0, 3.0, 1.0, 2.0, 0.5, 4.0 };
+  T2 b = { 1.0, 0.0, 2.0, 1.0, -1.0, 3.0 };
+  T2 c = { 0.5, 1.0, 1.5, 2.0, 2.5, 3.0 };
+
+  T2 e1 = c;
+  N::gemm(e1, 2.0, a, b, -1.0);
+  T2 r1 = a * b * 2.0 - c;
+
+  T2 e2 = [](N::index_t const&, N::index_t const&) { return std::nan(""); };
+  N::gemm(e2, 1.0, N::transpose(a), b, 0.0);
+  T2 r2 = N::transpose(a) * b;
+
+  T1 e3 = a;
+  N::gemm(e3, 1.0, a, N::transpose(a), 0.5);
+  T1 r3 = a * N::transpose(a) + a * 0.5;
+
+  T1 e4 = a;
+  N::gemm(e4, 1.0, e4 + a, e4, 1.0);
+  T1 r4 = (a + a) * a + a;
+
+  for (N::index_t row = 0; row < T2::number_of_rows; row++)
+    for (N::index_t col = 0; col < T2::number_of_columns; col++)
+    {
+      REQUIRE(e1(row, col) == Approx(r1(row, col)));
+      REQUIRE(e2(row, col) == Approx(r2(row, col)));
+    }
+
+  for (N::index_t row = 0; row < T1::number_of_rows; row++)
+    for (N::index_t col = 0; col < T1::number_of_columns; col++)
+    {
+      REQUIRE(e3(row, col) == Approx(r3(row, col)));
+      REQUIRE(e4(row, col) == Approx(r4(row, col)));
+    }
+}
+
+namespace
+{
+  constexpr bool is_near(double lhs, double rhs) { return N::Internal::abs(lhs - rhs) < 1e-12; }
+
+  template <typename T1, typename T2> constexpr bool is_near(T1 const& lhs, T2 const& rhs)
+  {
+    for (N::index_t row = 0; row < T1::number_of_rows; row++)
+      for (N::index_t col = 0; col < T1::number_of_columns; col++)
+        if (!is_near(lhs(row, col), rhs(row, col)))
+          return false;
+    return true;
+  }
+
+  // clang-format off
+  constexpr double spd_data[] = {  4.0, 2.0, 0.4, -1.0, 0.0,
+                                   2.0, 5.0, 1.0,  0.0, 0.5,
+                                   0.4, 1.0, 3.0,  0.5, 0.0,
+                                  -1.0, 0.0, 0.5,  2.0, 0.0,
+                                   0.0, 0.5, 0.0,  0.0, 1.0 };
+  // clang-format on
+}    // namespace
+
+TEST_CASE()
+{
+  using T1 = N::static_matrix_t<5, 5, double const>;
+  using T2 = N::static_matrix_t<5, 1, double>;
+  using T3 = N::static_matrix_t<3, 3, double>;
+  using I5 = N::identity_matrix_t<5, 5, double>;
+
+  constexpr T1 m{ spd_data };
+  constexpr T2 b{ 1.0, -2.0, 0.5, 3.0, 0.0 };
+  constexpr T3 s{ 2.0, 1.0, 0.0, 1.0, 3.0, 1.0, 0.0, 1.0, 4.0 };
+
+  static_assert(N::Internal::sqrt(2.25) == 1.5);
+  static_assert(is_near(N::Internal::sqrt(2.0), 1.4142135623730951));
+  static_assert(is_near(N::Internal::log(10.0), 2.302585092994046));
+  static_assert(is_near(N::Internal::log(0.125), -3.0 * 0.6931471805599453));
+
+  constexpr auto inv_m = N::inverse(m);
+  constexpr auto inv_s = N::inverse(s);
+  constexpr auto x     = N::solve(m, b);
+  static_assert(is_near(m * inv_m, I5()));
+  static_assert(is_near(s * inv_s, N::identity_matrix_t<3, 3, double>()));
+  static_assert(is_near(m * x, b));
+  static_assert(is_near(N::determinant(s), 18.0));
+
+  constexpr N::cholesky_t llt{ m };
+  constexpr N::ldlt_t     ldlt{ m };
+  static_assert(llt.is_positive_definite() && ldlt.is_positive_definite());
+  static_assert(is_near(llt.solve(b), x) && is_near(ldlt.solve(b), x));
+  static_assert(is_near(llt.determinant(), N::determinant(m)));
+  static_assert(is_near(ldlt.log_determinant(), N::Internal::log(N::determinant(m))));
+
+  constexpr auto gauss = [m, b]()
+  {
+    N::static_matrix_t<5, 5, double> a = m;
+    T2                               e = b;
+    N::Internal::solve(a, e);
+    return e;
+  }();
+  static_assert(is_near(gauss, x));
+
+  REQUIRE(is_near(N::inverse(m), inv_m));
+  REQUIRE(N::Internal::log(3.0) == std::log(3.0));
+}
+
+TEST_CASE()
+{
+  constexpr N::index_t batch = 7;
+  using T1                   = N::static_matrix_t<3, 2, double>;
+  using T2                   = N::static_matrix_t<2, 4, double, N::storage_order_t::column_major>;
+  using B1                   = N::static_matrix_batch_t<3, 2, double, batch>;
+  using B2                   = N::static_matrix_batch_t<2, 4, double, batch>;
+
+  static_assert(!N::readable_static_matrix_concept<B1>);
+
+  T1 a[batch];
+  T1 b[batch];
+  T2 c[batch];
+  for (N::index_t lane = 0; lane < batch; lane++)
+  {
+    a[lane] = [=](N::index_t const& r, N::index_t const& col) { return static_cast<double>(r * 3 + col + lane); };
+    b[lane] = [=](N::index_t const& r, N::index_t const& col) { return static_cast<double>(r) - 2.0 * col + 0.5 * lane; };
+    c[lane] = [=](N::index_t const& r, N::index_t const& col) { return static_cast<double>((r + col * lane) % 5) - 1.5; };
+  }
+
+  B1 ba{ a };
+  B1 bb{ b };
+  B2 bc{ c };
+
+  B1 e1 = ba + bb;
+  B1 e2 = ba - bb * 2.0;
+  auto e3 = (2.0 * ba) * bc;
+  static_assert(std::is_same_v<decltype(e3), N::static_matrix_batch_t<3, 4, double, batch>>);
+
+  T1 s1[batch];
+  e1.scatter(s1);
+
+  for (N::index_t lane = 0; lane < batch; lane++)
+  {
+    T1 const                          r1 = a[lane] + b[lane];
+    T1 const                          r2 = a[lane] - b[lane] * 2.0;
+    N::static_matrix_t<3, 4, double> const r3 = a[lane] * 2.0 * c[lane];
+    T1 const                          g2 = e2.get(lane);
+    auto const                        g3 = e3.get(lane);
+
+    for (N::index_t row = 0; row < 3; row++)
+    {
+      for (N::index_t col = 0; col < 2; col++)
+      {
+        REQUIRE(s1[lane](row, col) == r1(row, col));
+        REQUIRE(g2(row, col) == r2(row, col));
+      }
+      for (N::index_t col = 0; col < 4; col++)
+        REQUIRE(g3(row, col) == Approx(r3(row, col)));
+    }
+  }
+}
+
+TEST_CASE()
+{
+  using T1 = N::static_matrix_t<3, 4, double>;
+  using T2 = N::static_matrix_t<4, 2, double>;
+  using D  = N::dynamic_matrix_t<double>;
+
+  T1 a = [](N::index_t const& r, N::index_t const& c) { return static_cast<double>(r * 4 + c) - 5.0; };
+  T1 b = [](N::index_t const& r, N::index_t const& c) { return static_cast<double>(r) * 0.5 + c; };
+  T2 c = [](N::index_t const& r, N::index_t const& c) { return static_cast<double>((r + 3 * c) % 5) - 2.0; };
+
+  // every allocation has to come from the arena, the upstream resource refuses any request
+  std::byte                           buffer[4096];
+  std::pmr::monotonic_buffer_resource arena{ buffer, sizeof(buffer), std::pmr::null_memory_resource() };
+
+  D da{ a, &arena };
+  D db{ b, &arena };
+  D dc{ c, &arena };
+
+  D e1 = (da + db) * 2.0 - db;
+  D e2 = da * dc;
+  D e3 = N::transpose(dc) * N::transpose(da);
+  D e4 = da * da;
+
+  T1 const                         r1 = (a + b) * 2.0 - b;
+  N::static_matrix_t<3, 2, double> r2 = a * c;
+
+  REQUIRE(e1.rows() == 3);
+  REQUIRE(e1.columns() == 4);
+  REQUIRE(e2.rows() == 3);
+  REQUIRE(e2.columns() == 2);
+  REQUIRE(e3.rows() == 2);
+  REQUIRE(e3.columns() == 3);
+  REQUIRE(e4.empty());
+  REQUIRE((da + dc).empty());
+  REQUIRE((da - dc).empty());
+  REQUIRE(e1.get_allocator().resource() == &arena);
+
+  D e5 = da;
+  e5 += dc;
+  e5 -= dc;
+  REQUIRE(e5.rows() == 3);
+  REQUIRE(e5.columns() == 4);
+  REQUIRE(e5(2, 3) == a(2, 3));
+
+  N::dynamic_matrix_t<int> di{ 2, 3, [](N::index_t const& r, N::index_t const& c) { return static_cast<int>(r * 3 + c) * 7 - 10; } };
+  di /= 3;
+  for (N::index_t row = 0; row < 2; row++)
+    for (N::index_t col = 0; col < 3; col++)
+      REQUIRE(di(row, col) == (static_cast<int>(row * 3 + col) * 7 - 10) / 3);
+
+  for (N::index_t row = 0; row < 3; row++)
+  {
+    for (N::index_t col = 0; col < 4; col++)
+      REQUIRE(e1(row, col) == r1(row, col));
+    for (N::index_t col = 0; col < 2; col++)
+    {
+      REQUIRE(e2(row, col) == r2(row, col));
+      REQUIRE(e3(col, row) == r2(row, col));
+    }
+  }
+}
+
+TEST_CASE()
+{
+  using TS = N::static_matrix_t<4, 4, double>;
+  using TL = N::static_matrix_t<64, 64, double>;
+  using TH = N::static_matrix_t<3, 3, double, N::storage_order_t::row_major, N::heap_storage_t>;
+
+  static_assert(std::is_same_v<TS::storage_type, N::inline_storage_t>);
+  static_assert(std::is_same_v<TL::storage_type, N::heap_storage_t>);
+  static_assert(std::is_same_v<N::static_matrix_external_memory_t<3, 3, double>::storage_type, N::external_storage_t>);
+  static_assert(sizeof(TL) == sizeof(double*));
+
+  TL a = [](N::index_t const& r, N::index_t const& c) { return r == c ? 2.0 : 0.0; };
+  TL b = [](N::index_t const& r, N::index_t const& c) { return static_cast<double>(r + c); };
+
+  auto e1 = a * b + b;
+  static_assert(std::is_same_v<decltype(N::inverse(a)), TL>);
+  static_assert(std::is_same_v<decltype(N::transpose(a * b))::storage_type, N::heap_storage_t>);
+
+  TL e2 = b;
+  TL e3 = std::move(e2);
+  e2    = e1;
+  e2    = e2 + e3;
+
+  TH h1 = { 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 10.0 };
+  TH h2 = h1;
+  h2(0, 0) = -1.0;
+  TH h3 = N::transpose(h1);
+  h3    = h3 * 2.0;
+
+  REQUIRE(h1(0, 0) == 1.0);
+  REQUIRE(h2(0, 0) == -1.0);
+  REQUIRE(h3(0, 1) == 8.0);
+
+  for (N::index_t row = 0; row < 64; row += 9)
+    for (N::index_t col = 0; col < 64; col += 7)
+    {
+      REQUIRE(e1(row, col) == 3.0 * b(row, col));
+      REQUIRE(e2(row, col) == 4.0 * b(row, col));
+      REQUIRE(e3(row, col) == b(row, col));
+    }
+
+  // heap storage is transient during constant evaluation and therefore still usable there
+  static_assert(
+      []()
+      {
+        TH m = { 2.0, 0.0, 0.0, 0.0, 4.0, 0.0, 0.0, 0.0, 8.0 };
+        TH i = m * m;
+        return i(2, 2);
+      }() == 64.0);
+}
+
+namespace
+{
+  template <typename T> bool is_aligned_to(T const* ptr, std::size_t alignment) { return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0; }
+}    // namespace
+
+TEST_CASE()
+{
+  constexpr std::size_t simd = EXMATH_SIMD_ALIGNMENT;
+
+  using TD = N::static_matrix_t<4, 4, double>;
+  using TN = N::static_matrix_t<3, 3, double>;
+  using TH = N::static_matrix_t<64, 64, double>;
+  using TP = N::static_matrix_t<5, 3, float, N::storage_order_t::row_major, N::inline_storage_t, 32, true>;
+  using TC = N::static_matrix_t<3, 5, float, N::storage_order_t::column_major, N::inline_storage_t, 32, true>;
+
+  static_assert(alignof(TD) == simd && sizeof(TD) == 16 * sizeof(double));
+  static_assert(alignof(TN) == alignof(double) && sizeof(TN) == 9 * sizeof(double));
+  static_assert(N::static_matrix_external_memory_t<4, 4, double>::data_alignment == alignof(double));
+
+  static_assert(TP::leading_dimension == 8 && TP::number_of_stored_elements == 40);
+  static_assert(TC::leading_dimension == 8);
+  static_assert(N::strided_static_matrix_concept<TP> && !N::contiguous_static_matrix_concept<TP>);
+  static_assert(N::transpose_view_t<TP>::leading_dimension == 8);
+
+  TH h;
+  REQUIRE(is_aligned_to(h.data(), simd));
+
+  TP p = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f };
+  TC c = N::transpose(p);
+  REQUIRE(p(1, 0) == 4.0f);
+  REQUIRE(p(4, 2) == 15.0f);
+  REQUIRE(c(2, 4) == 15.0f);
+  for (N::index_t row = 0; row < 5; row++)
+    REQUIRE(is_aligned_to(&p(row, 0), 32));
+
+  N::static_matrix_t<5, 3, float> const d  = p + p;
+  N::static_matrix_t<3, 3, float> const r1 = N::transpose(p) * p;
+  N::static_matrix_t<3, 3, float> const e1 = c * p;
+  for (N::index_t row = 0; row < 5; row++)
+    for (N::index_t col = 0; col < 3; col++)
+      REQUIRE(d(row, col) == 2.0f * p(row, col));
+  for (N::index_t row = 0; row < 3; row++)
+    for (N::index_t col = 0; col < 3; col++)
+      REQUIRE(e1(row, col) == r1(row, col));
+
+  // padded operands take the strided blocked gemm, and assigning a padded matrix its own transpose goes through a temporary
+  using TQ = N::static_matrix_t<18, 18, double, N::storage_order_t::row_major, N::inline_storage_t, 64, true>;
+  static_assert(N::Internal::gemm_tiled_concept<TQ>);
+
+  TQ                                      q  = [](N::index_t const& r, N::index_t const& c) { return static_cast<double>((r * 5 + c * 3) % 7) - 3.0; };
+  N::static_matrix_t<18, 18, double> const qd = q;
+  TQ                                      e2;
+  N::gemm(e2, 1.0, q, N::transpose(q), 0.0);
+  N::static_matrix_t<18, 18, double> const r2 = qd * N::transpose(qd);
+  q = N::transpose(q);
+  for (N::index_t row = 0; row < 18; row++)
+    for (N::index_t col = 0; col < 18; col++)
+    {
+      REQUIRE(e2(row, col) == r2(row, col));
+      REQUIRE(q(row, col) == qd(col, row));
+    }
+}
+
+TEST_CASE()
+{
+  using TA = N::static_matrix_aligned_external_memory_t<2, 4, float, N::storage_order_t::row_major, 32>;
+
+  alignas(32) float buffer[16]{};
+
+  static_assert(!std::is_constructible_v<TA, float (&)[8]>);
+  REQUIRE(!TA::wrap(buffer + 1).has_value());
+  REQUIRE(!TA::wrap(nullptr).has_value());
+
+  auto view = TA::wrap(buffer + 8);
+  REQUIRE(view.has_value());
+
+  *view = [](N::index_t const& r, N::index_t const& c) { return static_cast<float>(r * 4 + c); };
+  REQUIRE(view->data() == buffer + 8);
+  REQUIRE(buffer[7] == 0.0f);
+  REQUIRE(buffer[8 + 5] == 5.0f);
+}
+
+TEST_CASE()
+{
+  using D = N::dynamic_matrix_t<float>;
+  using B = N::static_matrix_batch_t<3, 3, float, 70>;
+  using V = N::static_matrix_batch_t<3, 1, float, 70>;
+  using S = N::static_matrix_t<24, 24, float>;
+  using X = N::static_matrix_t<24, 2, float>;
+
+  N::isa_t const detected = N::detected_isa();
+  REQUIRE(N::selected_isa() == detected);
+  REQUIRE(N::select_isa(N::isa_t::baseline));
+  REQUIRE(N::selected_isa() == N::isa_t::baseline);
+
+  D const a{ 37, 29, [](N::index_t const& r, N::index_t const& c) { return static_cast<float>((r * 7 + c * 3) % 11) / 11.0f - 0.5f; } };
+  D const b{ 29, 41, [](N::index_t const& r, N::index_t const& c) { return static_cast<float>((r * 5 + c) % 13) / 13.0f - 0.5f; } };
+
+  B m;
+  for (N::index_t lane = 0; lane < B::batch_size; lane++)
+  {
+    auto fm = [=](N::index_t const& r, N::index_t const& c) { return r == c ? 2.0f : static_cast<float>((r + c + lane) % 4) / 4.0f; };
+    m.set(lane, N::static_matrix_t<3, 3, float>{ fm });
+  }
+
+  // large enough for the lu kernel, diagonally dominant so every variant pivots the same way
+  D const s{ 33, 33, [](N::index_t const& r, N::index_t const& c) { return r == c ? 9.0f : static_cast<float>((r * 3 + c * 5) % 7) / 7.0f - 0.5f; } };
+  D const x{ 33, 2, [](N::index_t const& r, N::index_t const& c) { return static_cast<float>((r + 2 * c) % 5) - 2.0f; } };
+  V       v;
+  for (N::index_t lane = 0; lane < V::batch_size; lane++)
+    v.set(lane, N::static_matrix_t<3, 1, float>{ 1.0f, static_cast<float>(lane % 3), -2.0f });
+
+  // static sizes at or above EXMATH_RUNTIME_KERNEL_MIN_ELEMENTS factor through the lu kernels of the selected variant
+  static_assert(N::Internal::runtime_kernel_concept<S>);
+  S const t = [](N::index_t const& r, N::index_t const& c) { return r == c ? 7.0f : static_cast<float>((r * 5 + c * 3) % 7) / 7.0f - 0.5f; };
+  X const y = [](N::index_t const& r, N::index_t const& c) { return static_cast<float>((r + 3 * c) % 5) - 2.0f; };
+
+  D const r1 = a * b;
+  D const r2 = a + a;
+  B const r3 = m * m - m;
+  D const r4 = N::solve(s, x);
+  V const r5 = N::solve(m, v);
+  X const r6 = N::solve(t, y);
+  S const r7 = N::inverse(t);
+
+  X const residual = t * r6 - y;
+  for (N::index_t row = 0; row < X::number_of_rows; row++)
+    for (N::index_t col = 0; col < X::number_of_columns; col++)
+      REQUIRE(residual(row, col) == Approx(0.0f).margin(1e-5));
+
+  for (N::isa_t isa : { N::isa_t::avx2, N::isa_t::avx512 })
+  {
+    if (!N::select_isa(isa))
+    {
+      REQUIRE(N::selected_isa() != isa);
+      continue;
+    }
+    REQUIRE(N::selected_isa() == isa);
+
+    D const e1 = a * b;
+    D const e2 = a + a;
+    B const e3 = m * m - m;
+    D const e4 = N::solve(s, x);
+    V const e5 = N::solve(m, v);
+    X const e6 = N::solve(t, y);
+    S const e7 = N::inverse(t);
+
+    for (N::index_t row = 0; row < r1.rows(); row++)
+      for (N::index_t col = 0; col < r1.columns(); col++)
+        REQUIRE(e1(row, col) == Approx(r1(row, col)).margin(1e-5));
+    for (N::index_t row = 0; row < r2.rows(); row++)
+      for (N::index_t col = 0; col < r2.columns(); col++)
+        REQUIRE(e2(row, col) == r2(row, col));
+    for (N::index_t row = 0; row < r4.rows(); row++)
+      for (N::index_t col = 0; col < r4.columns(); col++)
+        REQUIRE(e4(row, col) == Approx(r4(row, col)).margin(1e-5));
+    for (N::index_t row = 0; row < S::number_of_rows; row++)
+    {
+      for (N::index_t col = 0; col < X::number_of_columns; col++)
+        REQUIRE(e6(row, col) == Approx(r6(row, col)).margin(1e-5));
+      for (N::index_t col = 0; col < S::number_of_columns; col++)
+        REQUIRE(e7(row, col) == Approx(r7(row, col)).margin(1e-5));
+    }
+    for (N::index_t lane = 0; lane < B::batch_size; lane++)
+    {
+      REQUIRE(e3(1, 2, lane) == Approx(r3(1, 2, lane)));
+      for (N::index_t row = 0; row < 3; row++)
+        REQUIRE(e5(row, 0, lane) == Approx(r5(row, 0, lane)).margin(1e-5));
+    }
+  }
+
+  REQUIRE(N::select_isa(detected));
+}
+
+TEST_CASE()
+{
+  constexpr auto cm = N::storage_order_t::column_major;
+  constexpr auto rm = N::storage_order_t::row_major;
+
+  using TA = N::static_matrix_t<16, 12, double>;
+  using TB = N::static_matrix_t<12, 20, double, rm, N::inline_storage_t, 64, true>;
+  using TC = N::static_matrix_t<16, 20, double, cm>;
+  using IA = N::static_matrix_t<16, 12, int>;
+  using IB = N::static_matrix_t<12, 20, int>;
+  using IC = N::static_matrix_t<16, 20, int>;
+
+  static_assert(N::Internal::runtime_kernel_concept<TC, TA, TB>);
+  static_assert(!N::Internal::runtime_kernel_concept<IC, IA, IB>);
+  static_assert(!N::Internal::runtime_kernel_concept<N::static_matrix_t<4, 4, double>, N::static_matrix_t<4, 4, double>>);
+
+  auto fa = pattern_a<int>;
+  auto fb = [](N::index_t const& r, N::index_t const& c) { return static_cast<int>((r * 5 + c) % 13) - 6; };
+
+  TA const a = fa;
+  TB const b = fb;
+  IA const ia = fa;
+  IB const ib = fb;
+
+  TC const c  = a * b;
+  IC const ic = ia * ib;
+  TC const d  = N::transpose(N::transpose(c)) + c;
+  TA       e  = a;
+  e += a;
+  e -= a * 3.0;
+
+  for (N::index_t row = 0; row < TC::number_of_rows; row++)
+    for (N::index_t col = 0; col < TC::number_of_columns; col++)
+    {
+      REQUIRE(c(row, col) == static_cast<double>(ic(row, col)));
+      REQUIRE(d(row, col) == static_cast<double>(2 * ic(row, col)));
+    }
+
+  for (N::index_t row = 0; row < TA::number_of_rows; row++)
+    for (N::index_t col = 0; col < TA::number_of_columns; col++)
+      REQUIRE(e(row, col) == static_cast<double>(-ia(row, col)));
+
+  N::static_matrix_t<20, 16, double> ct{};
+  N::Internal::mult(ct, N::transpose(b), N::transpose(a));
+  for (N::index_t row = 0; row < TC::number_of_rows; row++)
+    for (N::index_t col = 0; col < TC::number_of_columns; col++)
+      REQUIRE(ct(col, row) == static_cast<double>(ic(row, col)));
+}
+
+TEST_CASE()
+{
+  using T1 = N::static_matrix_t<18, 18, double>;
+  using T2 = N::static_matrix_t<6, 6, double>;
+  using T3 = N::static_matrix_t<5, 4, double, N::storage_order_t::column_major>;
+
+  T1 p = [](N::index_t const& r, N::index_t const& c) { return static_cast<double>(r * 18 + c); };
+  T1 const q = p;
+
+  auto blk = N::block<6, 12, 6, 6>(p);
+  static_assert(N::strided_static_matrix_concept<decltype(blk)>);
+  static_assert(N::writeable_static_matrix_concept<decltype(blk)>);
+  static_assert(!N::writeable_static_matrix_concept<decltype(N::block<0, 0, 3, 3>(q))>);
+  static_assert(N::contiguous_static_matrix_concept<decltype(N::row<1>(p))>);
+  static_assert(!N::contiguous_static_matrix_concept<decltype(N::col<1>(p))>);
+  REQUIRE(blk.data() == p.data() + 6 * 18 + 12);
+
+  // extract, update and write back a 6x6 block; nothing outside of it changes
+  T2 x = blk;
+  T2 const k = [](N::index_t const& r, N::index_t const& c) { return r == c ? 2.0 : 0.0; };
+  blk = k * x + x;
+  for (N::index_t row = 0; row < 18; row++)
+    for (N::index_t col = 0; col < 18; col++)
+    {
+      bool const inside = row >= 6 && row < 12 && col >= 12;
+      REQUIRE(p(row, col) == (inside ? 3.0 : 1.0) * q(row, col));
+    }
+
+  // overlapping blocks of the same buffer
+  N::block<0, 0, 3, 3>(p) = N::block<1, 1, 3, 3>(p);
+  for (N::index_t row = 0; row < 3; row++)
+    for (N::index_t col = 0; col < 3; col++)
+      REQUIRE(p(row, col) == q(row + 1, col + 1));
+
+  // blocks as operands of the products and the elementwise kernels
+  T2 const prod = N::block<0, 0, 6, 6>(q) * N::block<12, 12, 6, 6>(q);
+  T2 const ref  = T2{ [&](N::index_t const& r, N::index_t const& c) { return q(r, c); } } *
+                 T2{ [&](N::index_t const& r, N::index_t const& c) { return q(r + 12, c + 12); } };
+  for (N::index_t row = 0; row < 6; row++)
+    for (N::index_t col = 0; col < 6; col++)
+      REQUIRE(prod(row, col) == ref(row, col));
+
+  N::row<17>(p) += N::row<16>(q);
+  N::col<0>(p) -= N::col<0>(q);
+  N::col<1>(p) *= 0.5;
+  auto lhs = N::row<0>(p);
+  lhs += lhs;
+  for (N::index_t idx = 0; idx < 18; idx++)
+  {
+    REQUIRE(p(17, idx) == (idx == 0 ? q(16, 0) : (idx == 1 ? 0.5 : 1.0) * (q(17, idx) + q(16, idx))));
+    if (idx >= 3 && idx < 17)
+      REQUIRE(p(idx, 0) == 0.0);
+  }
+  REQUIRE(p(0, 5) == 2.0 * q(0, 5));
+
+  T3 cm = [](N::index_t const& r, N::index_t const& c) { return static_cast<double>(r + 10 * c); };
+  REQUIRE(N::col<2>(cm).data() == cm.data() + 10);
+  REQUIRE(N::block<1, 1, 2, 2>(cm)(1, 0) == 12.0);
+
+  // blocks of temporaries are copies
+  auto const tmp = N::block<1, 1, 2, 2>(q * 2.0);
+  static_assert(std::is_same_v<decltype(tmp), N::static_matrix_t<2, 2, double> const>);
+  REQUIRE(tmp(1, 1) == 2.0 * q(2, 2));
+}
+
+TEST_CASE()
+{
+  constexpr N::index_t width  = 40;
+  constexpr N::index_t height = 32;
+
+  using TV = N::strided_view_t<6, 6, float>;
+  using TC = N::strided_view_t<6, 6, float const>;
+  using TL = N::strided_view_t<16, 16, float>;
+  using TM = N::static_matrix_t<6, 6, float>;
+
+  static_assert(N::runtime_strided_matrix_concept<TV>);
+  static_assert(!N::strided_static_matrix_concept<TV>);
+  static_assert(N::writeable_static_matrix_concept<TV>);
+  static_assert(!N::writeable_static_matrix_concept<TC>);
+  static_assert(N::Internal::runtime_kernel_concept<TL, TL, TL>);
+
+  float image[height * width];
+  float source[height * width];
+  for (N::index_t idx = 0; idx < height * width; idx++)
+    image[idx] = source[idx] = static_cast<float>(idx % 17) - 8.0f;
+  auto const at = [&](N::index_t const& r, N::index_t const& c) { return source[r * width + c]; };
+
+  REQUIRE(!TV::wrap(image, 5).has_value());
+  REQUIRE(!TV::wrap(nullptr, width).has_value());
+
+  auto tile  = *TV::wrap(image + 4 * width + 8, width);
+  auto other = *TC::wrap(source + 20 * width + 30, width);
+  REQUIRE(tile.stride() == width);
+  REQUIRE(tile(1, 2) == at(5, 10));
+
+  // compute in place on the tile; everything around it stays untouched
+  TM const k = [](N::index_t const& r, N::index_t const& c) { return r == c ? 2.0f : (r + 1 == c ? 1.0f : 0.0f); };
+  tile += other;
+  tile = k * tile;
+  tile *= 0.5f;
+  for (N::index_t row = 0; row < height; row++)
+    for (N::index_t col = 0; col < width; col++)
+    {
+      if (row < 4 || row >= 10 || col < 8 || col >= 14)
+      {
+        REQUIRE(image[row * width + col] == source[row * width + col]);
+        continue;
+      }
+      N::index_t const r = row - 4;
+      N::index_t const c = col - 8;
+      float const      e = r + 1 < 6 ? 2.0f * (at(row, col) + other(r, c)) + (at(row + 1, col) + other(r + 1, c)) : 2.0f * (at(row, col) + other(r, c));
+      REQUIRE(image[row * width + col] == Approx(0.5f * e));
+    }
+
+  // views of views and overlapping tiles of one buffer
+  REQUIRE(N::block<1, 1, 2, 2>(other)(0, 1) == at(21, 32));
+  REQUIRE(N::transpose(other)(0, 1) == at(21, 30));
+  auto shifted = *TV::wrap(image + 1, width);
+  auto origin  = *TV::wrap(image, width);
+  origin       = shifted;
+  for (N::index_t row = 0; row < 6; row++)
+    for (N::index_t col = 0; col < 6; col++)
+      REQUIRE(image[row * width + col] == source[row * width + col + 1]);
+
+  // large tiles go through the runtime kernels with the runtime stride
+  auto a = *TL::wrap(source, width);
+  auto b = *TL::wrap(source + 16 * width + 20, width);
+  auto c = *TL::wrap(image + 16 * width + 20, width);
+  N::gemm(c, 1.0f, a, b, 0.0f);
+  N::static_matrix_t<16, 16, float> const ref = N::static_matrix_t<16, 16, float>{ a } * N::static_matrix_t<16, 16, float>{ b };
+  for (N::index_t row = 0; row < 16; row++)
+    for (N::index_t col = 0; col < 16; col++)
+      REQUIRE(c(row, col) == Approx(ref(row, col)));
+
+  double cm[3 * 7]{};
+  auto   cv = *N::strided_view_t<3, 2, double, N::storage_order_t::column_major>::wrap(cm, 7);
+  cv(2, 1)  = 1.5;
+  REQUIRE(cm[7 + 2] == 1.5);
+}
+
+namespace
+{
+  template <N::index_t n, typename T, N::storage_order_t erg_order, N::storage_order_t op_order> void check_transposed_mult()
+  {
+    using TE = N::static_matrix_t<n, n, T, erg_order>;
+    using TO = N::static_matrix_t<n, n, T, op_order>;
+
+    TO const a = pattern_a<T>;
+    TO const b = pattern_b<T>;
+    TE const c = [](N::index_t const& r, N::index_t const& c) { return static_cast<T>((r + c) % 3); };
+
+    auto const check = [&](auto const& lhs, auto const& rhs) {
+      TE erg = c;
+      TE ref = c;
+      N::gemm(erg, T{ 2 }, lhs, rhs, T{ 1 });
+      N::Internal::gemm_reference(ref, T{ 2 }, TO{ lhs }, TO{ rhs }, T{ 1 });
+      TE const prod = lhs * rhs;
+      for (N::index_t row = 0; row < n; row++)
+        for (N::index_t col = 0; col < n; col++)
+        {
+          REQUIRE(erg(row, col) == Approx(ref(row, col)));
+          REQUIRE(prod(row, col) * 2 + c(row, col) == Approx(ref(row, col)));
+        }
+    };
+
+    check(a, b);
+    check(N::transpose(a), b);
+    check(a, N::transpose(b));
+    check(N::transpose(a), N::transpose(b));
+  }
+}    // namespace
+
+TEST_CASE()
+{
+  constexpr auto R = N::storage_order_t::row_major;
+  constexpr auto C = N::storage_order_t::column_major;
+
+  using T = N::static_matrix_t<4, 4, double>;
+  T const a = { 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0, 12.0, 13.0, 14.0, 15.0, 16.0 };
+  static_assert(std::is_same_v<decltype(N::transpose(N::transpose(a))), T const&>);
+  REQUIRE(&N::transpose(N::transpose(a)) == &a);
+
+  check_transposed_mult<3, double, R, R>();
+  check_transposed_mult<6, double, R, C>();
+  check_transposed_mult<6, double, C, R>();
+  check_transposed_mult<10, double, C, C>();
+  check_transposed_mult<10, int, C, R>();
+  check_transposed_mult<16, double, R, R>();
+  check_transposed_mult<16, float, C, C>();
+  check_transposed_mult<24, double, C, R>();
+}
+
+namespace
+{
+  template <typename Erg, typename Ref> void check_symmetric(Erg const& erg, Ref const& ref)
+  {
+    static_assert(Erg::number_of_rows == Erg::number_of_columns);
+    for (N::index_t row = 0; row < Erg::number_of_rows; row++)
+      for (N::index_t col = 0; col < Erg::number_of_columns; col++)
+      {
+        REQUIRE(erg(row, col) == erg(col, row));
+        REQUIRE(erg(row, col) == Approx(ref(row, col)));
+      }
+  }
+}    // namespace
+
+TEST_CASE()
+{
+  using T75 = N::static_matrix_t<7, 5, double>;
+  using T55 = N::static_matrix_t<5, 5, double, N::storage_order_t::column_major>;
+  using T12 = N::static_matrix_t<12, 12, float>;
+
+  T75 const a = [](N::index_t const& r, N::index_t const& c) { return 0.1 * ((r * 7 + c * 3) % 11) - 0.5; };
+  T55 const p = [](N::index_t const& r, N::index_t const& c) { return r == c ? 2.0 : 0.1 / (1.0 + r + c); };
+  T12 const f = [](N::index_t const& r, N::index_t const& c) { return 0.1f * static_cast<float>((r * 5 + c * 2) % 13) - 0.6f; };
+  T12 const q = [](N::index_t const& r, N::index_t const& c) { return r == c ? 1.5f : 0.05f * static_cast<float>(r + c); };
+
+  auto const g = N::gram(a);
+  static_assert(decltype(g)::number_of_rows == 7);
+  check_symmetric(g, a * N::transpose(a));
+  check_symmetric(N::gram_t(a), N::transpose(a) * a);
+  check_symmetric(N::gram(N::transpose(a)), N::transpose(a) * a);
+  check_symmetric(N::sandwich(a, p), a * p * N::transpose(a));
+  check_symmetric(N::sandwich(f, q), f * q * N::transpose(f));
+  check_symmetric(N::sandwich(N::transpose(f), q), N::transpose(f) * q * f);
+
+  // views and lazy expressions as inputs
+  check_symmetric(N::gram(N::block<1, 0, 3, 5>(a)), N::block<1, 0, 3, 5>(a) * N::transpose(N::block<1, 0, 3, 5>(a)));
+  auto const fv = N::block<2, 2, 4, 5>(f);
+  auto const qv = N::block<0, 0, 5, 5>(q);
+  check_symmetric(N::sandwich(fv, qv), fv * qv * N::transpose(fv));
+  check_symmetric(N::gram_t(a + a), N::transpose(a) * a * 4.0);
+
+  // large products go through the runtime gemm kernels and get their lower triangle mirrored
+  N::static_matrix_t<24, 16, double> const b = [](N::index_t const& r, N::index_t const& c) { return 0.05 * ((r * 3 + c * 5) % 17) - 0.4; };
+  check_symmetric(N::gram(b), b * N::transpose(b));
+  check_symmetric(N::gram_t(N::transpose(b)), b * N::transpose(b));
+
+  using TG = N::static_matrix_t<20, 24, double, N::storage_order_t::column_major>;
+  TG const h = [](N::index_t const& r, N::index_t const& c) { return 0.1 * ((r + c * 7) % 9) - 0.4; };
+  check_symmetric(N::sandwich(h, N::gram(b)), h * N::gram(b) * N::transpose(h));
+
+  constexpr auto c = N::gram(N::static_matrix_t<2, 3, int>{ 1, 2, 3, 4, 5, 6 });
+  static_assert(c(0, 0) == 14 && c(0, 1) == 32 && c(1, 0) == 32 && c(1, 1) == 77);
+}
+
+TEST_CASE()
+{
+  using T  = N::static_matrix_t<4, 4, double>;
+  using TC = N::static_matrix_t<4, 4, double, N::storage_order_t::column_major>;
+  using I  = N::identity_matrix_t<4, 4, double>;
+  using Z  = N::zero_matrix_t<4, 4, double>;
+
+  T const a = [](N::index_t const& r, N::index_t const& c) { return static_cast<double>(r * 4 + c) - 7.5; };
+
+  // products with identity and zero fold at the type level
+  static_assert(std::is_same_v<decltype(I{} * I{}), I>);
+  static_assert(std::is_same_v<decltype(a * Z{}), Z>);
+  static_assert(std::is_same_v<decltype(Z{} * N::transpose(a)), Z>);
+  static_assert(std::is_same_v<decltype(a + Z{}), T const&>);
+  static_assert(std::is_same_v<decltype(Z{} + a), T const&>);
+  static_assert(std::is_same_v<decltype(a - Z{}), T const&>);
+  static_assert(std::is_same_v<decltype(T{ a } + Z{}), T>);
+  static_assert(std::is_same_v<decltype(Z{} + Z{}), Z>);
+  REQUIRE(&(a + Z{}) == &a);
+
+  T const ai = a * I{};
+  T const ia = I{} * a;
+  T const sz = Z{} - a;
+  TC      e  = a + I{};
+  T       f  = a;
+  f -= I{};
+  T g = a;
+  g += Z{};
+  for (N::index_t row = 0; row < 4; row++)
+    for (N::index_t col = 0; col < 4; col++)
+    {
+      double const d = row == col ? 1.0 : 0.0;
+      REQUIRE(ai(row, col) == a(row, col));
+      REQUIRE(ia(row, col) == a(row, col));
+      REQUIRE(sz(row, col) == -a(row, col));
+      REQUIRE(e(row, col) == a(row, col) + d);
+      REQUIRE((I{} + a)(row, col) == a(row, col) + d);
+      REQUIRE(f(row, col) == a(row, col) - d);
+      REQUIRE(g(row, col) == a(row, col));
+    }
+
+  // shifting the diagonal in place and through views
+  T h = a;
+  h   = h - I{};
+  N::block<0, 0, 2, 3>(h) += N::identity_matrix_t<2, 3, double>{};
+  REQUIRE(h(0, 0) == a(0, 0));
+  REQUIRE(h(1, 1) == a(1, 1));
+  REQUIRE(h(2, 2) == a(2, 2) - 1.0);
+  REQUIRE(h(0, 1) == a(0, 1));
+
+  N::gemm(h, 2.0, a, Z{}, 0.5);
+  REQUIRE(h(3, 3) == 0.5 * (a(3, 3) - 1.0));
+  N::gemm(h, 2.0, Z{}, a, 0.0);
+  REQUIRE(h(1, 2) == 0.0);
+
+  constexpr N::static_matrix_t<2, 2, int> c = N::static_matrix_t<2, 2, int>{ 1, 2, 3, 4 } + N::identity_matrix_t<2, 2, int>{};
+  static_assert(c(0, 0) == 2 && c(0, 1) == 2 && c(1, 0) == 3 && c(1, 1) == 5);
+}
+
+TEST_CASE()
+{
+  using D  = N::diagonal_matrix_t<5, double>;
+  using T  = N::static_matrix_t<5, 5, double>;
+  using TC = N::static_matrix_t<5, 3, double, N::storage_order_t::column_major>;
+  using I  = N::identity_matrix_t<5, 5, double>;
+
+  D const  d = { 1.0, -2.0, 0.5, 4.0, 3.0 };
+  T const  a = [](N::index_t const& r, N::index_t const& c) { return static_cast<double>(r * 5 + c) - 12.0; };
+  TC const b = ramp;
+  T const  dense = d;
+
+  static_assert(N::readable_static_matrix_concept<D>);
+  static_assert(sizeof(D) == 5 * sizeof(double));
+  static_assert(std::is_same_v<decltype(d * d), D>);
+  static_assert(std::is_same_v<decltype(d + d), D>);
+  static_assert(std::is_same_v<decltype(d - I{}), D>);
+  static_assert(std::is_same_v<decltype(d * I{}), D>);
+  REQUIRE(dense(1, 1) == -2.0);
+  REQUIRE(dense(1, 2) == 0.0);
+
+  // mixed expressions with dense matrices scale rows or columns and only touch the diagonal in sums
+  auto const r1 = d * b;
+  auto const r2 = N::transpose(b) * d;
+  T const    r3 = a + d;
+  T const    r4 = d - a;
+  T const    r5 = (a * 2.0) - d;
+  T          r6 = a;
+  r6 -= d;
+  T r7 = a;
+  N::gemm(r7, 2.0, a, d, -1.0);
+  auto const r8 = d * d + I{};
+
+  auto const e1 = dense * b;
+  auto const e2 = N::transpose(b) * dense;
+  for (N::index_t row = 0; row < 5; row++)
+  {
+    for (N::index_t col = 0; col < 3; col++)
+    {
+      REQUIRE(r1(row, col) == e1(row, col));
+      REQUIRE(r2(col, row) == e2(col, row));
+    }
+    for (N::index_t col = 0; col < 5; col++)
+    {
+      REQUIRE(r3(row, col) == a(row, col) + dense(row, col));
+      REQUIRE(r4(row, col) == dense(row, col) - a(row, col));
+      REQUIRE(r5(row, col) == 2.0 * a(row, col) - dense(row, col));
+      REQUIRE(r6(row, col) == a(row, col) - dense(row, col));
+      REQUIRE(r7(row, col) == Approx(2.0 * (a * dense)(row, col) - a(row, col)));
+      REQUIRE(r8(row, col) == (row == col ? d.diagonal(row) * d.diagonal(row) + 1.0 : 0.0));
+    }
+  }
+
+  constexpr auto s = N::scaled_identity<3>(2.5);
+  static_assert(s(1, 1) == 2.5 && s(0, 1) == 0.0);
+  constexpr auto v = N::diagonal_matrix_t<3, int>{ N::static_matrix_t<3, 1, int>{ 1, 2, 3 } };
+  static_assert(v(2, 2) == 3);
+}
+
+namespace
+{
+  template <N::index_t n, N::triangular_storage_t storage> void check_triangular_mult()
+  {
+    using T  = N::static_matrix_t<n, n, double>;
+    using TC = N::static_matrix_t<n, 3, double>;
+    using L  = N::lower_triangular_t<n, double, storage>;
+    using U  = N::upper_triangular_t<n, double, storage>;
+
+    T const  a = pattern_a<double>;
+    TC const b = ramp;
+    L const  l{ a };
+    U const  u{ a };
+    T const  ld = l;
+    T const  ud = u;
+
+    static_assert(std::is_same_v<decltype(l * l), L>);
+    static_assert(std::is_same_v<decltype(u * u), U>);
+    REQUIRE(l(0, n - 1) == 0.0);
+    REQUIRE(u(n - 1, 0) == 0.0);
+    REQUIRE(l(n - 1, 0) == a(n - 1, 0));
+
+    auto const r1 = l * b;
+    auto const r2 = u * b;
+    T const    r3 = a * l;
+    T const    r4 = l * u;
+    T const    r5 = l * l;
+    T const    r6 = u * u;
+    auto const e1 = ld * b;
+    auto const e2 = ud * b;
+    T const    e3 = a * ld;
+    T const    e4 = ld * ud;
+    T const    e5 = ld * ld;
+    T const    e6 = ud * ud;
+    for (N::index_t row = 0; row < n; row++)
+    {
+      for (N::index_t col = 0; col < 3; col++)
+      {
+        REQUIRE(r1(row, col) == e1(row, col));
+        REQUIRE(r2(row, col) == e2(row, col));
+      }
+      for (N::index_t col = 0; col < n; col++)
+      {
+        REQUIRE(r3(row, col) == e3(row, col));
+        REQUIRE(r4(row, col) == e4(row, col));
+        REQUIRE(r5(row, col) == e5(row, col));
+        REQUIRE(r6(row, col) == e6(row, col));
+      }
+    }
+  }
+}    // namespace
+
+TEST_CASE()
+{
+  static_assert(sizeof(N::lower_triangular_t<4, double>) == 10 * sizeof(double));
+  static_assert(sizeof(N::upper_triangular_t<4, double, N::triangular_storage_t::full>) == 16 * sizeof(double));
+
+  // below and above the size at which the products switch from the dense loops to the triangle-aware ones
+  check_triangular_mult<4, N::triangular_storage_t::packed>();
+  check_triangular_mult<4, N::triangular_storage_t::full>();
+  check_triangular_mult<12, N::triangular_storage_t::packed>();
+  check_triangular_mult<12, N::triangular_storage_t::full>();
+}
+
+TEST_CASE()
+{
+  using S  = N::symmetric_matrix_t<5, double>;
+  using T  = N::static_matrix_t<5, 5, double>;
+  using TC = N::static_matrix_t<5, 3, double>;
+  using D  = N::diagonal_matrix_t<5, double>;
+
+  TC const a = pattern_a<double>;
+  T const  m = [](N::index_t const& r, N::index_t const& c) { return static_cast<double>(r * 5 + c) - 12.0; };
+  D const  d = { 1.0, -2.0, 3.0, -4.0, 5.0 };
+  S const  s{ m };
+  S const  g{ a * N::transpose(a) };
+  T const  sd = s;
+  T const  gd = g;
+
+  static_assert(N::readable_static_matrix_concept<S>);
+  static_assert(!N::writeable_static_matrix_concept<S>);
+  static_assert(sizeof(S) == 15 * sizeof(double));
+  static_assert(std::is_same_v<decltype(s + g), S>);
+  static_assert(std::is_same_v<decltype(s - g), S>);
+  static_assert(std::is_same_v<decltype(s + d), S>);
+  static_assert(std::is_same_v<decltype(d - s), S>);
+  static_assert(std::is_same_v<decltype(s * 2.0), S>);
+  static_assert(std::is_same_v<decltype(2.0 * s), S>);
+  REQUIRE(s(1, 3) == m(3, 1));
+  REQUIRE(s(3, 1) == m(3, 1));
+
+  // sums and scaling work on the unique elements only
+  S const r1 = s + g;
+  S const r2 = s - g;
+  S const r3 = s + d;
+  S const r4 = d - s;
+  S const r5 = 2.0 * s;
+  S const r6 = s - N::identity_matrix_t<5, 5, double>{};
+  S       r7 = s;
+  r7 += g;
+  r7 *= 0.5;
+  r7 -= s;
+  S r8 = g;
+  N::syrk(r8, 2.0, a, -1.0);
+  S r9;
+  N::syrk(r9, 1.0, s, 0.0);
+  N::syrk(r9, 1.0, r9, 1.0);
+  // erg read through views
+  S r12 = s;
+  N::syrk(r12, 1.0, N::transpose(r12), 1.0);
+  S r13 = s;
+  N::syrk(r13, -1.0, N::block<0, 1, 5, 3>(r13), 2.0);
+
+  T const    r10 = s * m;
+  T const    r11 = m * s;
+  T const    e9  = sd * sd;
+  T const    e12 = e9 * e9 + e9;
+  auto const e10 = sd * m;
+  auto const e11 = m * sd;
+  auto const e13 = N::block<0, 1, 5, 3>(sd) * N::transpose(N::block<0, 1, 5, 3>(sd));
+  for (N::index_t row = 0; row < 5; row++)
+    for (N::index_t col = 0; col < 5; col++)
+    {
+      double const diag = row == col ? d.diagonal(row) : 0.0;
+      REQUIRE(r1(row, col) == sd(row, col) + gd(row, col));
+      REQUIRE(r2(row, col) == sd(row, col) - gd(row, col));
+      REQUIRE(r3(row, col) == sd(row, col) + diag);
+      REQUIRE(r4(row, col) == diag - sd(row, col));
+      REQUIRE(r5(row, col) == 2.0 * sd(row, col));
+      REQUIRE(r6(row, col) == sd(row, col) - (row == col ? 1.0 : 0.0));
+      REQUIRE(r7(row, col) == Approx(0.5 * (sd(row, col) + gd(row, col)) - sd(row, col)));
+      REQUIRE(r8(row, col) == gd(row, col));
+      REQUIRE(r9(row, col) == Approx(e12(row, col)));
+      REQUIRE(r12(row, col) == Approx(e9(row, col) + sd(row, col)));
+      REQUIRE(r13(row, col) == Approx(2.0 * sd(row, col) - e13(row, col)));
+      REQUIRE(r10(row, col) == e10(row, col));
+      REQUIRE(r11(row, col) == e11(row, col));
+    }
+
+  // too large to be unpacked on the stack
+  using SL = N::symmetric_matrix_t<48, double>;
+  using TL = N::static_matrix_t<48, 48, double>;
+  static_assert(!N::Internal::symmetric_unpack_concept<SL>);
+  TL const ml = pattern_b<double>;
+  SL const sl{ ml };
+  TL const sld = sl;
+  TL const r14 = sl * ml;
+  TL const r15 = ml * sl;
+  TL const r16 = sl * sl;
+  TL const e14 = sld * ml;
+  TL const e15 = ml * sld;
+  TL const e16 = sld * sld;
+  for (N::index_t row = 0; row < 48; row++)
+    for (N::index_t col = 0; col < 48; col++)
+    {
+      REQUIRE(r14(row, col) == Approx(e14(row, col)));
+      REQUIRE(r15(row, col) == Approx(e15(row, col)));
+      REQUIRE(r16(row, col) == Approx(e16(row, col)));
+    }
+}
+
+TEST_CASE()
+{
+  using B  = N::banded_matrix_t<6, 2, 1, double>;
+  using T  = N::static_matrix_t<6, 6, double>;
+  using TC = N::static_matrix_t<6, 3, double>;
+
+  T const  a = pattern_a<double>;
+  TC const c = ramp;
+  B const  b{ a };
+  T const  bd = b;
+
+  static_assert(N::readable_static_matrix_concept<B>);
+  static_assert(sizeof(B) == 6 * 4 * sizeof(double));
+  static_assert(sizeof(N::tridiagonal_matrix_t<6, double>) == 6 * 3 * sizeof(double));
+  REQUIRE(b(0, 1) == a(0, 1));
+  REQUIRE(b(0, 2) == 0.0);
+  REQUIRE(b(3, 1) == a(3, 1));
+  REQUIRE(b(3, 0) == 0.0);
+
+  // products only sum over the band
+  auto const r1 = b * c;
+  T const    r2 = a * b;
+  T const    r3 = b * b;
+  auto const e1 = bd * c;
+  T const    e2 = a * bd;
+  T const    e3 = bd * bd;
+  for (N::index_t row = 0; row < 6; row++)
+  {
+    for (N::index_t col = 0; col < 3; col++)
+      REQUIRE(r1(row, col) == e1(row, col));
+    for (N::index_t col = 0; col < 6; col++)
+    {
+      REQUIRE(r2(row, col) == e2(row, col));
+      REQUIRE(r3(row, col) == e3(row, col));
+    }
+  }
+}
@@ -0,0 +1,60 @@
+# fails if a kernel of tst_ExMath_CODEGEN.cpp calls out of line or grows beyond its instruction budget
+
+set(budgets
+	exmath_codegen_add_3x3f   40
+	exmath_codegen_mult_3x3f  120
+	exmath_codegen_add_4x4d   70
+	exmath_codegen_mult_4x4d  260
+	exmath_codegen_solve_3x3f 450
+	exmath_codegen_solve_4x4d 700
+	exmath_codegen_chain_3x3f 650
+)
+
+execute_process(COMMAND ${OBJDUMP} -d -r --no-show-raw-insn ${OBJECT} OUTPUT_VARIABLE disassembly RESULT_VARIABLE result)
+if(NOT result EQUAL 0)
+	message(FATAL_ERROR "${OBJDUMP} failed on ${OBJECT}")
+endif()
+
+string(REPLACE ";" "," disassembly "${disassembly}")
+string(REPLACE "\n" ";" lines "${disassembly}")
+
+set(failed FALSE)
+list(LENGTH budgets length)
+math(EXPR last "${length} - 1")
+foreach(idx RANGE 0 ${last} 2)
+	math(EXPR next "${idx} + 1")
+	list(GET budgets ${idx} symbol)
+	list(GET budgets ${next} budget)
+
+	set(inside FALSE)
+	set(count 0)
+	set(calls 0)
+	foreach(line IN LISTS lines)
+		if(line MATCHES "^[0-9a-f]+ <(.*)>:$")
+			set(mnemonic "")
+			if(CMAKE_MATCH_1 STREQUAL symbol)
+				set(inside TRUE)
+			else()
+				set(inside FALSE)
+			endif()
+		elseif(inside AND line MATCHES "^ +[0-9a-f]+:\t([a-z0-9]+)")
+			math(EXPR count "${count} + 1")
+			set(mnemonic ${CMAKE_MATCH_1})
+			if(mnemonic STREQUAL "call")
+				math(EXPR calls "${calls} + 1")
+			endif()
+		elseif(inside AND mnemonic STREQUAL "jmp" AND line MATCHES "R_X86_64_PLT32")
+			# a jmp relocated to another function is a tail call
+			math(EXPR calls "${calls} + 1")
+		endif()
+	endforeach()
+
+	message(STATUS "${symbol}: ${count} instructions (budget ${budget}), ${calls} calls")
+	if(count EQUAL 0 OR count GREATER budget OR calls GREATER 0)
+		set(failed TRUE)
+	endif()
+endforeach()
+
+if(failed)
+	message(FATAL_ERROR "unrolled kernels are missing, call out of line or exceed their instruction budget")
+endif()
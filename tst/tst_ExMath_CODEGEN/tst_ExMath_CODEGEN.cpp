@@ -0,0 +1,33 @@
+#include <ExMath.hpp>
+
+// kernels whose machine code check_codegen.cmake inspects; extern "C" keeps the symbol names readable in the disassembly
+
+namespace
+{
+  namespace N = ExMath;
+
+  using M3f = N::static_matrix_t<3, 3, float>;
+  using M4d = N::static_matrix_t<4, 4, double>;
+  using V4d = N::static_matrix_t<4, 1, double>;
+}    // namespace
+
+extern "C"
+{
+  void exmath_codegen_add_3x3f(M3f& erg, M3f const& lhs, M3f const& rhs) { N::Internal::add(erg, lhs, rhs); }
+  void exmath_codegen_mult_3x3f(M3f& erg, M3f const& lhs, M3f const& rhs) { N::Internal::mult(erg, lhs, rhs); }
+  void exmath_codegen_add_4x4d(M4d& erg, M4d const& lhs, M4d const& rhs) { N::Internal::add(erg, lhs, rhs); }
+  void exmath_codegen_mult_4x4d(M4d& erg, M4d const& lhs, M4d const& rhs) { N::Internal::mult(erg, lhs, rhs); }
+  void exmath_codegen_solve_3x3f(M3f& erg, M3f const& mat, M3f const& b) { erg = N::solve(mat, b); }
+  void exmath_codegen_solve_4x4d(V4d& erg, M4d const& mat, V4d const& b) { erg = N::solve(mat, b); }
+
+  // the kernels chained in one function, where the optimizer is least willing to unroll on its own
+  void exmath_codegen_chain_3x3f(M3f& erg, M3f const& lhs, M3f const& rhs)
+  {
+    M3f sum;
+    M3f prod;
+    N::Internal::add(sum, lhs, rhs);
+    N::Internal::mult(prod, sum, lhs);
+    N::Internal::mult(erg, prod, rhs);
+    erg = N::solve(sum, erg);
+  }
+}
@@ -0,0 +1,436 @@
+#include <ExMath.hpp>
+#include <ut_catch.hpp>
+
+namespace N = ExMath;
+
+namespace
+{
+  // diag on the diagonal plus values in [-0.5, 0.5) everywhere
+  constexpr auto dominant(double const& diag)
+  {
+    return [=](N::index_t const& r, N::index_t const& c) { return (r == c ? diag : 0.0) + static_cast<double>((r * 7 + c * 3) % 11) / 11.0 - 0.5; };
+  }
+
+  // right hand sides
+  constexpr auto ramp = [](N::index_t const& r, N::index_t const& c) { return static_cast<double>(r) - static_cast<double>(c) * 0.5; };
+}    // namespace
+
+TEST_CASE()
+{
+  using T1 = N::static_matrix_t<4, 4, double>;
+  using T2 = N::static_matrix_t<4, 3, double>;
+
+  // clang-format off
+  T1 m = { 0.0, 2.0,  1.0, 4.0,
+           3.0, 1.0, -2.0, 0.5,
+           1.0, 0.0,  5.0, 2.0,
+           2.0, 7.0,  1.0, 1.0 };
+
+  T2 x = { 1.0,  2.0, -1.0,
+           0.5, -3.0,  4.0,
+           2.0,  1.0,  0.0,
+          -1.0,  0.0,  3.0 };
+  // clang-format on
+
+  N::lu_factorization_t lu{ m };
+
+  static_assert(std::is_same_v<decltype(lu), N::lu_factorization_t<4, double>>);
+  REQUIRE(!lu.is_singular());
+
+  T2 b  = m * x;
+  T2 e1 = lu.solve(b);
+  T2 e2 = lu.solve(b * 2.0);
+  T1 e3 = lu.inverse() * m;
+
+  for (N::index_t row = 0; row < T2::number_of_rows; row++)
+    for (N::index_t col = 0; col < T2::number_of_columns; col++)
+    {
+      REQUIRE(e1(row, col) == Approx(x(row, col)).margin(1e-12));
+      REQUIRE(e2(row, col) == Approx(2.0 * x(row, col)).margin(1e-12));
+    }
+
+  for (N::index_t row = 0; row < T1::number_of_rows; row++)
+    for (N::index_t col = 0; col < T1::number_of_columns; col++)
+      REQUIRE(e3(row, col) == Approx(row == col ? 1.0 : 0.0).margin(1e-12));
+
+  REQUIRE(lu.determinant() == Approx(407.5));
+}
+
+TEST_CASE()
+{
+  using T1 = N::static_matrix_t<3, 3, float>;
+
+  T1 m = { 1.0f, 2.0f, 3.0f, 2.0f, 4.0f, 6.0f, 1.0f, 0.0f, 1.0f };
+
+  N::lu_factorization_t lu{ m };
+
+  REQUIRE(lu.is_singular());
+  REQUIRE(lu.determinant() == 0.0f);
+}
+
+TEST_CASE()
+{
+  using T1 = N::static_matrix_t<4, 4, double>;
+  using T2 = N::static_matrix_t<4, 2, double>;
+
+  // clang-format off
+  T1 m = { 4.0,  2.0, 0.4, -1.0,
+           2.0,  5.0, 1.0,  0.0,
+           0.4,  1.0, 3.0,  0.5,
+          -1.0,  0.0, 0.5,  2.0 };
+
+  T2 x = { 1.0, -2.0,
+           0.5,  3.0,
+          -1.0,  0.0,
+           2.0,  1.0 };
+  // clang-format on
+
+  N::cholesky_t         llt{ m };
+  N::ldlt_t             ldlt{ m };
+  N::lu_factorization_t lu{ m };
+
+  REQUIRE(llt.is_positive_definite());
+  REQUIRE(ldlt.is_positive_definite());
+  REQUIRE(!ldlt.is_singular());
+
+  T2 b  = m * x;
+  T2 e1 = llt.solve(b);
+  T2 e2 = ldlt.solve(b);
+
+  for (N::index_t row = 0; row < T2::number_of_rows; row++)
+    for (N::index_t col = 0; col < T2::number_of_columns; col++)
+    {
+      REQUIRE(e1(row, col) == Approx(x(row, col)).margin(1e-12));
+      REQUIRE(e2(row, col) == Approx(x(row, col)).margin(1e-12));
+    }
+
+  REQUIRE(llt.determinant() == Approx(lu.determinant()));
+  REQUIRE(ldlt.determinant() == Approx(lu.determinant()));
+  REQUIRE(llt.log_determinant() == Approx(std::log(lu.determinant())));
+  REQUIRE(ldlt.log_determinant() == Approx(std::log(lu.determinant())));
+
+  T1 e3 = llt.inverse() * m;
+  for (N::index_t row = 0; row < T1::number_of_rows; row++)
+    for (N::index_t col = 0; col < T1::number_of_columns; col++)
+      REQUIRE(e3(row, col) == Approx(row == col ? 1.0 : 0.0).margin(1e-12));
+}
+
+TEST_CASE()
+{
+  using T1 = N::static_matrix_t<2, 2, double>;
+
+  T1 m = { 1.0, 2.0, 2.0, 1.0 };
+
+  N::cholesky_t llt{ m };
+  N::ldlt_t     ldlt{ m };
+
+  REQUIRE(!llt.is_positive_definite());
+  REQUIRE(!ldlt.is_positive_definite());
+  REQUIRE(!ldlt.is_singular());
+  REQUIRE(ldlt.determinant() == Approx(-3.0));
+
+  auto e = ldlt.solve(T1{ 1.0, 0.0, 0.0, 1.0 }) * m;
+  REQUIRE(e(0, 0) == Approx(1.0));
+  REQUIRE(e(0, 1) == Approx(0.0).margin(1e-12));
+  REQUIRE(e(1, 0) == Approx(0.0).margin(1e-12));
+  REQUIRE(e(1, 1) == Approx(1.0));
+}
+
+namespace
+{
+  template <N::index_t size> void check_closed_form()
+  {
+    using T1 = N::static_matrix_t<size, size, double>;
+
+    T1 m = [](N::index_t const& r, N::index_t const& c) { return r == c ? 4.0 + r : static_cast<double>((r * 3 + c * 5) % 7) / 7.0 - 0.4; };
+
+    N::lu_factorization_t lu{ m };
+    T1                    e1 = N::inverse(m);
+    T1                    e2;
+    REQUIRE(N::try_inverse(m, e2));
+    REQUIRE(N::determinant(m) == Approx(lu.determinant()));
+
+    T1 const r = lu.inverse();
+    for (N::index_t row = 0; row < size; row++)
+      for (N::index_t col = 0; col < size; col++)
+      {
+        REQUIRE(e1(row, col) == Approx(r(row, col)).margin(1e-14));
+        REQUIRE(e2(row, col) == Approx(r(row, col)).margin(1e-14));
+      }
+
+    T1 s = [](N::index_t const& r, N::index_t const& c) { return static_cast<double>((r + 1) * (c + 1)); };
+    T1 e3 = m;
+    if constexpr (size > 1)
+    {
+      REQUIRE(!N::try_inverse(s, e3));
+      REQUIRE(N::determinant(s) == 0.0);
+      REQUIRE(e3(0, 0) == m(0, 0));
+    }
+  }
+}    // namespace
+
+TEST_CASE()
+{
+  check_closed_form<1>();
+  check_closed_form<2>();
+  check_closed_form<3>();
+  check_closed_form<4>();
+  check_closed_form<5>();
+}
+
+TEST_CASE()
+{
+  constexpr N::index_t batch = 9;
+  using T1                   = N::static_matrix_t<6, 6, double>;
+  using T2                   = N::static_matrix_t<6, 2, double>;
+
+  T1 a[batch];
+  T2 b[batch];
+  for (N::index_t lane = 0; lane < batch; lane++)
+  {
+    // lane-dependent zero on the diagonal forces a different row exchange in every lane
+    a[lane] = [=](N::index_t const& r, N::index_t const& c)
+    { return r == c ? (r == lane % 6 ? 0.0 : 3.0 + r) : static_cast<double>((r * 5 + c * 3 + lane) % 7) / 7.0 - 0.3; };
+    b[lane] = [=](N::index_t const& r, N::index_t const& c) { return static_cast<double>(r) - 1.5 * c + lane; };
+  }
+  // one singular lane must not disturb the others
+  a[4] = [](N::index_t const& r, N::index_t const& c) { return static_cast<double>((r + 1) * (c + 1)); };
+
+  N::static_matrix_batch_t<6, 6, double, batch> ba{ a };
+  N::static_matrix_batch_t<6, 2, double, batch> bb{ b };
+
+  auto const x   = N::solve(ba, bb);
+  auto const inv = N::inverse(ba);
+
+  for (N::index_t lane = 0; lane < batch; lane++)
+  {
+    if (lane == 4)
+      continue;
+
+    T2 const r1 = N::solve(a[lane], b[lane]);
+    T1 const r2 = N::inverse(a[lane]);
+    T2 const e1 = x.get(lane);
+    T1 const e2 = inv.get(lane);
+
+    for (N::index_t row = 0; row < 6; row++)
+    {
+      for (N::index_t col = 0; col < 2; col++)
+        REQUIRE(e1(row, col) == Approx(r1(row, col)).margin(1e-12));
+      for (N::index_t col = 0; col < 6; col++)
+        REQUIRE(e2(row, col) == Approx(r2(row, col)).margin(1e-12));
+    }
+  }
+}
+
+TEST_CASE()
+{
+  constexpr N::index_t batch = 5;
+  using T1                   = N::static_matrix_t<3, 3, float>;
+
+  T1 a[batch];
+  for (N::index_t lane = 0; lane < batch; lane++)
+    a[lane] = [=](N::index_t const& r, N::index_t const& c) { return r == c ? 2.0f + lane : static_cast<float>(r + 2 * c) / 4.0f; };
+
+  N::static_matrix_batch_t<3, 3, float, batch> const inv = N::inverse(N::static_matrix_batch_t<3, 3, float, batch>{ a });
+
+  T1 e[batch];
+  inv.scatter(e);
+  for (N::index_t lane = 0; lane < batch; lane++)
+  {
+    T1 const r = N::inverse(a[lane]);
+    for (N::index_t row = 0; row < 3; row++)
+      for (N::index_t col = 0; col < 3; col++)
+        REQUIRE(e[lane](row, col) == Approx(r(row, col)));
+  }
+}
+
+TEST_CASE()
+{
+  using D = N::dynamic_matrix_t<double>;
+
+  constexpr N::index_t size = 40;
+
+  D m{ size, size, [](N::index_t const& r, N::index_t const& c) { return r == c ? 0.5 : static_cast<double>((r * 7 + c * 3) % 11) / 11.0 - 0.5; } };
+  D x{ size, 3, [](N::index_t const& r, N::index_t const& c) { return static_cast<double>(r % 5) - 1.5 * c; } };
+
+  D e1 = N::solve(m, m * x);
+  D e2 = N::inverse(m) * m;
+
+  REQUIRE(e1.rows() == size);
+  REQUIRE(e1.columns() == 3);
+  for (N::index_t row = 0; row < size; row++)
+  {
+    for (N::index_t col = 0; col < 3; col++)
+      REQUIRE(e1(row, col) == Approx(x(row, col)).margin(1e-10));
+    for (N::index_t col = 0; col < size; col++)
+      REQUIRE(e2(row, col) == Approx(row == col ? 1.0 : 0.0).margin(1e-10));
+  }
+
+  REQUIRE(N::solve(m, x * m).empty());
+
+  N::static_matrix_t<4, 4, double> const s = { 0.0, 2.0, 1.0, 4.0, 3.0, 1.0, -2.0, 0.5, 1.0, 0.0, 5.0, 2.0, 2.0, 7.0, 1.0, 1.0 };
+
+  D const                          e3 = N::inverse(D{ s });
+  N::static_matrix_t<4, 4, double> r3 = N::inverse(s);
+  for (N::index_t row = 0; row < 4; row++)
+    for (N::index_t col = 0; col < 4; col++)
+      REQUIRE(e3(row, col) == Approx(r3(row, col)).margin(1e-12));
+}
+
+TEST_CASE()
+{
+  using T1 = N::static_matrix_t<16, 16, double>;
+  using T2 = N::static_matrix_t<16, 3, double>;
+  using T3 = N::static_matrix_t<16, 16, double, N::storage_order_t::column_major>;
+
+  T1 const m = dominant(8.0);
+  T2 const x = ramp;
+  T2 const b = m * x;
+
+  // row major goes to the runtime kernel, column major stays with the template
+  static_assert(N::Internal::runtime_kernel_concept<T1, T2>);
+
+  T1 a1 = m;
+  T2 e1 = b;
+  N::Internal::solve(a1, e1);
+
+  T3 a2 = m;
+  T2 e2 = b;
+  N::Internal::solve(a2, e2);
+
+  for (N::index_t row = 0; row < T2::number_of_rows; row++)
+    for (N::index_t col = 0; col < T2::number_of_columns; col++)
+    {
+      REQUIRE(e1(row, col) == Approx(x(row, col)).margin(1e-12));
+      REQUIRE(e2(row, col) == Approx(x(row, col)).margin(1e-12));
+    }
+}
+
+TEST_CASE()
+{
+  using D = N::diagonal_matrix_t<4, double>;
+  using T = N::static_matrix_t<4, 2, double>;
+
+  D const d = { 2.0, -4.0, 0.5, 8.0 };
+  T const b = { 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0 };
+
+  static_assert(std::is_same_v<decltype(N::inverse(d)), D>);
+  D const inv = N::inverse(d);
+  T const x   = N::solve(d, b);
+  T const r   = d * x;
+  for (N::index_t row = 0; row < 4; row++)
+  {
+    REQUIRE(inv.diagonal(row) * d.diagonal(row) == 1.0);
+    for (N::index_t col = 0; col < 2; col++)
+      REQUIRE(r(row, col) == Approx(b(row, col)));
+  }
+  REQUIRE(N::determinant(d) == -32.0);
+
+  N::static_matrix_t<4, 4, double> e;
+  REQUIRE(N::try_inverse(d, e));
+  REQUIRE(e(3, 3) == 0.125);
+  REQUIRE(e(0, 3) == 0.0);
+  REQUIRE(!N::try_inverse(D{ 1.0, 0.0, 1.0, 1.0 }, e));
+  REQUIRE(e(3, 3) == 0.125);
+}
+
+namespace
+{
+  template <N::index_t size, N::triangle_t tri, N::triangular_storage_t storage> void check_triangular_solve()
+  {
+    using T1 = N::static_matrix_t<size, size, double>;
+    using T2 = N::static_matrix_t<size, 3, double>;
+    using T3 = N::triangular_matrix_t<size, double, tri, storage>;
+
+    T1 const m = [](N::index_t const& r, N::index_t const& c) { return (r == c ? 4.0 + r : 0.0) + static_cast<double>((r * 7 + c * 3) % 11) / 11.0 - 0.5; };
+    T2 const b = ramp;
+    T3 const t{ m };
+    T1 const d = t;
+
+    T2 const r1 = N::solve(d, b);
+    T2 const e1 = N::trsm(t, b);
+    T2 const e2 = N::solve(t, b);
+    for (N::index_t row = 0; row < size; row++)
+      for (N::index_t col = 0; col < 3; col++)
+      {
+        REQUIRE(e1(row, col) == Approx(r1(row, col)).margin(1e-12));
+        REQUIRE(e2(row, col) == Approx(r1(row, col)).margin(1e-12));
+      }
+
+    auto const r2 = N::solve(d, N::col<1>(b));
+    auto const e3 = N::trsv(t, N::col<1>(b));
+    for (N::index_t row = 0; row < size; row++)
+      REQUIRE(e3(row, 0) == Approx(r2(row, 0)).margin(1e-12));
+
+    static_assert(std::is_same_v<decltype(N::inverse(t)), T3>);
+    T1 const r3 = N::inverse(d);
+    T1 const e4 = N::inverse(t);
+    for (N::index_t row = 0; row < size; row++)
+      for (N::index_t col = 0; col < size; col++)
+        REQUIRE(e4(row, col) == Approx(r3(row, col)).margin(1e-12));
+    REQUIRE(N::determinant(t) == Approx(N::determinant(d)));
+  }
+}    // namespace
+
+TEST_CASE()
+{
+  check_triangular_solve<4, N::triangle_t::lower, N::triangular_storage_t::packed>();
+  check_triangular_solve<4, N::triangle_t::upper, N::triangular_storage_t::packed>();
+  check_triangular_solve<12, N::triangle_t::lower, N::triangular_storage_t::full>();
+  check_triangular_solve<12, N::triangle_t::upper, N::triangular_storage_t::packed>();
+}
+
+TEST_CASE()
+{
+  using T1 = N::static_matrix_t<12, 12, double>;
+  using T2 = N::static_matrix_t<12, 3, double>;
+  using B1 = N::tridiagonal_matrix_t<12, double>;
+  using B2 = N::banded_matrix_t<12, 2, 1, double>;
+
+  T1 const m = dominant(4.0);
+  T2 const b = ramp;
+
+  // a diagonally dominant tridiagonal system goes through the thomas algorithm
+  B1 const t{ m };
+  T1 const td = t;
+  T2 const r1 = N::solve(td, b);
+  T2 const e1 = N::solve(t, b);
+
+  // zeros on the diagonal need the row swaps of the banded lu
+  T1 z = m;
+  z(0, 0) = 0.0;
+  z(5, 5) = 0.0;
+  B2 const g{ z };
+  T1 const gd = g;
+  T2 const r2 = N::solve(gd, b);
+  T2 const e2 = N::solve(g, b);
+  T1 const r3 = N::inverse(gd);
+  T1 const e3 = N::inverse(g);
+
+  for (N::index_t row = 0; row < 12; row++)
+  {
+    for (N::index_t col = 0; col < 3; col++)
+    {
+      REQUIRE(e1(row, col) == Approx(r1(row, col)).margin(1e-12));
+      REQUIRE(e2(row, col) == Approx(r2(row, col)).margin(1e-12));
+    }
+    for (N::index_t col = 0; col < 12; col++)
+      REQUIRE(e3(row, col) == Approx(r3(row, col)).margin(1e-12));
+  }
+  REQUIRE(N::determinant(t) == Approx(N::determinant(td)));
+  REQUIRE(N::determinant(g) == Approx(N::determinant(gd)));
+
+  N::banded_lu_t const lu{ g };
+  REQUIRE(!lu.is_singular());
+  REQUIRE(N::banded_lu_t{ B2{} }.is_singular());
+
+  // a zero pivot stops the thomas algorithm, the solve falls back to the banded lu
+  N::static_matrix_t<3, 3, double> const p = { 0.0, 1.0, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0, 1.0 };
+  N::static_matrix_t<3, 1, double> const y = { 1.0, 2.0, 3.0 };
+  N::static_matrix_t<3, 1, double>       x = y;
+  REQUIRE(!N::Internal::tridiagonal_solve(N::tridiagonal_matrix_t<3, double>{ p }, x));
+  auto const r4 = N::solve(N::tridiagonal_matrix_t<3, double>{ p }, y);
+  REQUIRE(r4(0, 0) == Approx(0.0).margin(1e-12));
+  REQUIRE(r4(1, 0) == Approx(1.0));
+  REQUIRE(r4(2, 0) == Approx(2.0));
+}